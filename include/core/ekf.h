@@ -9,17 +9,23 @@
  * - 칼만 게인 계산 (Kalman Gain Calculation)
  * - 상태 업데이트 (State Update)
  * - 공분산 업데이트 (Covariance Update)
+ * - 정상 상태 고정 게인 모드 (Steady-State Gain)
+ * - SoC 기반 게인 스케줄링 모드 (ekf_gain_table.h)
  */
 
 #ifndef EKF_H
 #define EKF_H
 
 #include "rtwtypes.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* 게인 테이블 (ekf_gain_table.h) */
+struct EKF_GainTable_T;
+
 /* EKF 상태 구조체 */
 typedef struct {
     real_T soc;                    /* State of Charge (0.0 ~ 1.0) */
@@ -34,6 +40,17 @@ typedef struct {
     real_T capacity;               /* 배터리 용량 (Ah) */
 } EKF_Params_T;
 
+/* 정상 상태 고정 게인 모드 설정 구조체 */
+typedef struct {
+    boolean_T enable;              /* 모드 사용 여부 */
+    real_T gain_tolerance;         /* 게인 수렴 판정 상대 오차 */
+    uint32_T hold_steps;           /* 게인 고정 전 연속 수렴 스텝 수 */
+    real_T dt_tolerance;           /* 샘플링 시간 변화 허용 상대 오차 */
+    real_T rest_current;           /* 휴지 상태 판정 전류 크기 (A) */
+    real_T nis_threshold;          /* 정규화 혁신 제곱 (NIS) 평균 한계 */
+    real_T nis_forgetting;         /* NIS 평균 망각 인자 (0 ~ 1) */
+} EKF_SteadyState_T;
+
 /* EKF 내부 상태 구조체 */
 typedef struct {
     real_T P[4];                   /* 상태 추정 오차 공분산 행렬 (2x2) */
@@ -42,6 +59,11 @@ typedef struct {
     real_T K[2];                   /* 칼만 게인 (2x1) */
     real_T innovation;             /* 혁신 (Innovation) */
     real_T innovation_covariance;  /* 혁신 공분산 */
+    boolean_T gain_frozen;         /* 게인 고정 여부 (공분산 전파 생략) */
+    uint32_T converged_steps;      /* 게인 연속 수렴 스텝 수 */
+    real_T last_dt;                /* 직전 예측의 샘플링 시간 */
+    int32_T current_regime;        /* 전류 영역 (-1: 충전, 0: 휴지, 1: 방전) */
+    real_T nis_average;            /* NIS 지수 가중 평균 */
 } EKF_Internal_T;
 
 /* EKF 전체 구조체 */
@@ -49,6 +71,8 @@ typedef struct {
     EKF_State_T state;             /* 현재 상태 */
     EKF_Params_T params;           /* EKF 파라미터 */
     EKF_Internal_T internal;       /* 내부 계산 변수 */
+    EKF_SteadyState_T steady;      /* 정상 상태 게인 모드 설정 */
+    const struct EKF_GainTable_T* gain_table; /* 게인 스케줄링 테이블 (NULL이면 미사용) */
     boolean_T initialized;         /* 초기화 완료 플래그 */
 } EKF_T;
 
@@ -62,6 +86,42 @@ typedef struct {
  */
 boolean_T EKF_Initialize(EKF_T* ekf, const EKF_Params_T* params);
 
+/**
+ * @brief 정상 상태 고정 게인 모드 설정
+ * 공분산과 게인이 수렴하면 게인을 고정하고 공분산 전파를 생략하여,
+ * 스텝당 연산을 상태 예측과 x += K * innovation 만으로 줄임.
+ * 샘플링 시간, 전류 영역(충전/휴지/방전), 혁신 통계(NIS)가 바뀌면
+ * 전체 업데이트로 자동 복귀함
+ * @param ekf EKF 구조체 포인터
+ * @param config 모드 설정 (enable이 false이면 모드 해제)
+ */
+void EKF_SetSteadyState(EKF_T* ekf, const EKF_SteadyState_T* config);
+
+/**
+ * @brief 게인 고정 여부 반환
+ * @param ekf EKF 구조체 포인터
+ * @return 현재 고정 게인으로 동작 중이면 true
+ */
+boolean_T EKF_IsGainFrozen(const EKF_T* ekf);
+
+/**
+ * @brief 게인 스케줄링 모드 설정
+ * 설정하면 공분산을 전파하지 않고 현재 SoC로 테이블에서 보간한 게인을 사용
+ * (정상 상태 고정 게인 모드보다 우선). 테이블은 EKF보다 오래 유지되어야 함
+ * @param ekf EKF 구조체 포인터
+ * @param table 게인 테이블 (NULL이면 모드 해제, 전체 업데이트로 복귀)
+ */
+void EKF_SetGainSchedule(EKF_T* ekf, const struct EKF_GainTable_T* table);
+
+/**
+ * @brief 측정 야코비안 H (1x2)
+ * EKF_Initialize가 설정하는 EKF_Update의 H와 게인 테이블 계산(EKF_GainTable_Compute)이
+ * 함께 쓰는 정의. 현재 측정 모델은 SoC와 무관하게 [1, 0]
+ * @param soc 동작점 SoC
+ * @param H 출력: 측정 야코비안 (2)
+ */
+void EKF_GetMeasurementJacobian(real_T soc, real_T* H);
+
 /**
  * @brief EKF 상태 예측 단계
  * @param ekf EKF 구조체 포인터
@@ -70,6 +130,30 @@ boolean_T EKF_Initialize(EKF_T* ekf, const EKF_Params_T* params);
  */
 void EKF_Predict(EKF_T* ekf, real_T current, real_T dt);
 
+/**
+ * @brief EKF 다중 스텝 예측 (측정 없이 전류 샘플 n개 누적)
+ * 전압 측정이 전류보다 드물게 들어올 때 EKF_Predict n회를 대체.
+ * 전하량은 전류 합으로 한 번에 적분하고, 공분산은 닫힌 형태
+ * P = F^n * P * (F^n)^T + sum_{k<n} F^k * Q * (F^k)^T 로 한 번에 전파.
+ * SoC 범위 제한은 구간 끝에서 한 번만 적용됨
+ * @param ekf EKF 구조체 포인터
+ * @param current 배터리 전류 샘플 배열 (A, n개)
+ * @param n 샘플 개수
+ * @param dt 샘플 간격 (s)
+ */
+void EKF_PredictMulti(EKF_T* ekf, const real_T* current, size_t n, real_T dt);
+
+/**
+ * @brief EKF 다중 스텝 예측 (누적 전류 합 사용)
+ * EKF_PredictMulti와 같지만 전류 샘플 대신 합만 받으므로,
+ * 호출자가 샘플을 저장하지 않고 합과 개수만 누적할 수 있음
+ * @param ekf EKF 구조체 포인터
+ * @param current_sum n개 전류 샘플의 합 (A)
+ * @param n 샘플 개수
+ * @param dt 샘플 간격 (s)
+ */
+void EKF_PredictSum(EKF_T* ekf, real_T current_sum, size_t n, real_T dt);
+
 /**
  * @brief EKF 측정 업데이트 단계
  * @param ekf EKF 구조체 포인터
@@ -87,6 +171,13 @@ void EKF_Update(EKF_T* ekf, real_T voltage_measured, real_T current_measured);
  */
 void EKF_Step(EKF_T* ekf, real_T voltage_measured, real_T current_measured, real_T dt);
 
+/**
+ * @brief EKF 해제
+ * EKF는 동적 메모리를 사용하지 않으므로 초기화 플래그만 해제
+ * @param ekf EKF 구조체 포인터
+ */
+void EKF_Cleanup(EKF_T* ekf);
+
 /**
  * @brief 현재 SoC 값 반환
  * @param ekf EKF 구조체 포인터
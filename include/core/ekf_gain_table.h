@@ -0,0 +1,93 @@
+/*
+ * ekf_gain_table.h
+ *
+ * EKF 게인 스케줄링 모듈
+ * SoC 격자의 각 점에서 EKF_Update와 같은 측정 야코비안(EKF_GetMeasurementJacobian)으로
+ * 수렴한 정상 상태 칼만 게인을 오프라인으로 계산해 두고,
+ * 실행 중에는 공분산 전파 없이 SoC로 게인을 보간하여 사용.
+ * 현재 측정 모델은 H가 SoC와 무관하므로 모든 격자점의 게인이 같음
+ * (측정 모델이 SoC에 의존하게 되면 테이블이 그대로 격자별 게인이 됨)
+ *
+ * 주요 기능:
+ * - 이산 리카티 반복으로 격자별 정상 상태 게인 계산 (오프라인)
+ * - 게인 테이블 생성 / 해제
+ * - SoC 기반 게인 보간 (실행 중)
+ */
+
+#ifndef EKF_GAIN_TABLE_H
+#define EKF_GAIN_TABLE_H
+
+#include "rtwtypes.h"
+#include "ekf.h"
+#include "lookup_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define EKF_GAIN_TABLE_MAX_ITERATIONS  100000  /* 격자점당 최대 리카티 반복 횟수 */
+#define EKF_GAIN_TABLE_TOLERANCE       1e-12   /* 게인 수렴 판정 상대 오차 */
+
+/* 게인 테이블 구조체 */
+typedef struct EKF_GainTable_T {
+    LookupTable_T gain_soc;        /* K[0] (SoC 보정 게인) vs SoC */
+    LookupTable_T gain_error;      /* K[1] (전압 오차 보정 게인) vs SoC */
+    boolean_T initialized;         /* 초기화 완료 플래그 */
+} EKF_GainTable_T;
+
+/* make gain_table이 생성하는 build/ekf_gain_table_data.c의 배열 (그 파일을 링크할 때만 정의됨) */
+extern const uint32_T EKF_GainTableData_Points;
+extern const real_T EKF_GainTableData_Soc[];
+extern const real_T EKF_GainTableData_GainSoc[];
+extern const real_T EKF_GainTableData_GainError[];
+
+/* 함수 선언 */
+
+/**
+ * @brief SoC 격자별 정상 상태 칼만 게인 계산 (오프라인)
+ * 각 격자점에서 H = EKF_GetMeasurementJacobian(soc)로 P = F*P*F^T + Q, P = (I-K*H)*P를
+ * 게인이 수렴할 때까지 반복 (EKF_Predict + EKF_Update와 같은 순서).
+ * 이전 격자점의 수렴 공분산에서 시작하여 반복 횟수를 줄임
+ * @param params EKF 파라미터 (Q, R, dt, capacity 사용)
+ * @param soc_grid SoC 격자 (num_points)
+ * @param num_points 격자점 개수
+ * @param gain_soc 출력: 격자별 K[0] (num_points)
+ * @param gain_error 출력: 격자별 K[1] (num_points)
+ * @return 최대 반복 횟수 안에 수렴하지 못한 격자점 개수
+ */
+uint32_T EKF_GainTable_Compute(const EKF_Params_T* params, const real_T* soc_grid,
+                               uint32_T num_points, real_T* gain_soc, real_T* gain_error);
+
+/**
+ * @brief 게인 테이블 초기화
+ * @param table 게인 테이블 구조체 포인터
+ * @param soc_grid SoC 격자 (오름차순, num_points)
+ * @param gain_soc 격자별 K[0]
+ * @param gain_error 격자별 K[1]
+ * @param num_points 격자점 개수
+ * @return 초기화 성공 여부
+ */
+boolean_T EKF_GainTable_Initialize(EKF_GainTable_T* table, const real_T* soc_grid,
+                                   const real_T* gain_soc, const real_T* gain_error,
+                                   uint32_T num_points);
+
+/**
+ * @brief 게인 테이블 해제 (메모리 정리)
+ * @param table 게인 테이블 구조체 포인터
+ */
+void EKF_GainTable_Cleanup(EKF_GainTable_T* table);
+
+/**
+ * @brief SoC에 해당하는 게인 보간
+ * @param table 게인 테이블 구조체 포인터
+ * @param soc 현재 SoC
+ * @param K 출력: 칼만 게인 (2x1)
+ */
+void EKF_GainTable_Lookup(const EKF_GainTable_T* table, real_T soc, real_T* K);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EKF_GAIN_TABLE_H */
@@ -0,0 +1,66 @@
+/*
+ * ekf_parallel.h
+ *
+ * 시간 병렬 EKF 모듈 (오프라인 재생용)
+ * 하나의 긴 측정 기록을 청크로 나누어 여러 코어에서 동시에 필터링하고,
+ * 결과는 같은 기록에 EKF_Step을 순차 호출한 결과와 허용 오차 안에서 일치
+ *
+ * 구성 (Särkkä / García-Fernández 병렬 칼만 필터):
+ * - 공분산: 스텝마다 (A, C, J) 요소를 만들고 결합 법칙이 성립하는 연산으로 묶어
+ *   청크 단위 축약 -> 청크 경계 직렬 스캔 -> 청크 내부 순차 전파의 3단계로 계산
+ *   (공분산과 게인은 측정값과 무관하므로 한 번만 계산)
+ * - 상태: 게인이 정해지면 한 스텝은 아핀 사상 x = M * x + u 이므로 같은 3단계 스캔으로 계산
+ * - 반복 재선형화: SoC / 전압 오차 범위 제한은 아핀이 아니므로, 궤적에서 제한이 걸린
+ *   스텝을 상수 행으로 선형화. 처음에는 초기 상태에서 시작한 청크별 공칭 궤적으로,
+ *   이후에는 직전 반복의 궤적으로 다시 선형화하여 청크 경계 상태가 순차 결과와
+ *   일치할 때까지 반복. 최대 반복 후에도 어긋나면 해당 청크부터 순차로 보정
+ *
+ * 정상 상태 고정 게인 / 게인 스케줄링 모드는 적용하지 않고 항상 전체 공분산 업데이트를 수행
+ */
+
+#ifndef EKF_PARALLEL_H
+#define EKF_PARALLEL_H
+
+#include "rtwtypes.h"
+#include "ekf.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define EKF_PARALLEL_MAX_THREADS   64      /* 최대 작업 스레드(청크) 개수 */
+#define EKF_PARALLEL_MIN_CHUNK     4096    /* 청크당 최소 스텝 수 */
+
+/* 병렬 필터 설정 구조체 */
+typedef struct {
+    uint32_T num_threads;          /* 작업 스레드 개수 (0이면 온라인 코어 수) */
+    uint32_T max_iterations;       /* 재선형화 최대 반복 횟수 */
+    real_T tolerance;              /* 청크 경계 상태 일치 허용 오차 */
+} EKF_Parallel_Config_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 측정 기록 전체를 시간 병렬로 필터링
+ * EKF_Step(ekf, voltage[k], current[k], dt)를 k = 0 .. n-1 순서로 호출한 것과 같은
+ * 결과를 계산하고, 끝나면 ekf의 상태와 공분산을 마지막 스텝 이후 값으로 갱신
+ * @param ekf EKF 구조체 포인터 (초기 상태 / 공분산 사용)
+ * @param voltage 측정 전압 배열 (V, n개)
+ * @param current 측정 전류 배열 (A, n개)
+ * @param n 스텝 개수
+ * @param dt 샘플링 시간 (s)
+ * @param config 병렬 설정 (NULL이면 기본값)
+ * @param soc_out 출력: 스텝별 SoC (n개, NULL이면 저장하지 않음)
+ * @return 사용한 재선형화 반복 횟수 (입력 오류 또는 메모리 부족 시 0)
+ */
+uint32_T EKF_FilterParallel(EKF_T* ekf, const real_T* voltage, const real_T* current,
+                            size_t n, real_T dt, const EKF_Parallel_Config_T* config,
+                            real_T* soc_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EKF_PARALLEL_H */
@@ -0,0 +1,115 @@
+/*
+ * ekf_smoother.h
+ *
+ * EKF 고정 구간 스무더 모듈 (Rauch-Tung-Striebel, 과거 기록 분석용)
+ * 인과적 EKF_Step 출력 대신 기록 전체를 본 평활 SoC를 계산
+ *
+ * 메모리 (체크포인트 / 재계산):
+ * - 순방향 패스는 sqrt(n) 스텝마다 필터 상태만 체크포인트로 저장
+ * - 역방향 패스는 구간을 뒤에서부터 하나씩 체크포인트에서 다시 필터링하여
+ *   구간 내 필터 상태를 복원한 뒤 RTS 역방향 재귀를 수행
+ * - 작업 메모리 O(sqrt(n)), 연산량은 순방향 필터 약 2회 + 역방향 1회
+ * - 평활 결과는 저장하지 않고 싱크 콜백으로 k = n-1 .. 0 (역순) 스트리밍
+ *
+ * 정상 상태 고정 게인 / 게인 스케줄링 모드는 적용하지 않고 전체 공분산으로 필터링
+ */
+
+#ifndef EKF_SMOOTHER_H
+#define EKF_SMOOTHER_H
+
+#include "rtwtypes.h"
+#include "ekf.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define EKF_SMOOTHER_MAX_THREADS   64      /* 일괄 처리 최대 작업 스레드 개수 */
+
+/**
+ * @brief 평활 결과 싱크 (k = n-1 .. 0 순서로 호출)
+ * @param context 호출자 컨텍스트
+ * @param k 스텝 인덱스
+ * @param state 평활 상태
+ * @param P 평활 공분산 (2x2)
+ */
+typedef void (*EKF_Smoother_Sink_T)(void* context, size_t k, const EKF_State_T* state, const real_T* P);
+
+/* 일괄 처리용 기록 구조체 */
+typedef struct {
+    const real_T* voltage;         /* 측정 전압 배열 (V, n개) */
+    const real_T* current;         /* 측정 전류 배열 (A, n개) */
+    size_t n;                      /* 스텝 개수 */
+    EKF_Smoother_Sink_T sink;      /* 평활 결과 싱크 */
+    void* context;                 /* 싱크 컨텍스트 */
+    boolean_T success;             /* 출력: 처리 성공 여부 */
+} EKF_Smoother_Trace_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 고정 구간 RTS 평활
+ * ekf의 현재 상태 / 공분산을 초기값으로 EKF_Step(voltage[k], current[k], dt)를
+ * 순차 적용한 필터 결과를 평활하여 싱크로 출력. ekf는 변경하지 않음
+ * @param ekf 초기 EKF (읽기 전용)
+ * @param voltage 측정 전압 배열 (V, n개)
+ * @param current 측정 전류 배열 (A, n개)
+ * @param n 스텝 개수
+ * @param dt 샘플링 시간 (s)
+ * @param sink 평활 결과 싱크
+ * @param context 싱크 컨텍스트
+ * @return 성공 여부 (입력 오류 또는 메모리 부족 시 false)
+ */
+boolean_T EKF_Smooth(const EKF_T* ekf, const real_T* voltage, const real_T* current, size_t n,
+                     real_T dt, EKF_Smoother_Sink_T sink, void* context);
+
+/**
+ * @brief 체크포인트 간격을 지정한 고정 구간 RTS 평활
+ * EKF_Smooth와 같은 결과를 내며 메모리 / 재계산 균형만 바뀜
+ * (간격 1이면 스텝마다 체크포인트, n 이상이면 구간 하나에 필터 결과 전체 저장)
+ * @param ekf 초기 EKF (읽기 전용)
+ * @param voltage 측정 전압 배열 (V, n개)
+ * @param current 측정 전류 배열 (A, n개)
+ * @param n 스텝 개수
+ * @param dt 샘플링 시간 (s)
+ * @param interval 체크포인트 간격 (스텝, 0이면 ceil(sqrt(n)))
+ * @param sink 평활 결과 싱크
+ * @param context 싱크 컨텍스트
+ * @return 성공 여부 (입력 오류 또는 메모리 부족 시 false)
+ */
+boolean_T EKF_SmoothCheckpointed(const EKF_T* ekf, const real_T* voltage, const real_T* current,
+                                 size_t n, real_T dt, size_t interval,
+                                 EKF_Smoother_Sink_T sink, void* context);
+
+/**
+ * @brief 여러 기록을 스레드에 나누어 평활 (기록 단위 병렬)
+ * @param ekf 초기 EKF (모든 기록에 공통, 읽기 전용)
+ * @param traces 기록 배열 (각 success 필드에 결과 기록)
+ * @param count 기록 개수
+ * @param dt 샘플링 시간 (s)
+ * @param num_threads 작업 스레드 개수 (0이면 온라인 코어 수)
+ * @return 성공한 기록 개수
+ */
+uint32_T EKF_SmoothBatch(const EKF_T* ekf, EKF_Smoother_Trace_T* traces, uint32_T count,
+                         real_T dt, uint32_T num_threads);
+
+/**
+ * @brief 길이 n 기록의 평활에 필요한 작업 메모리 (바이트, 기본 간격 ceil(sqrt(n)) 기준)
+ * @param n 스텝 개수
+ * @return 작업 메모리 크기
+ */
+size_t EKF_Smoother_WorkspaceSize(size_t n);
+
+/**
+ * @brief 평활 SoC를 배열에 저장하는 기본 싱크
+ * @param context 출력 배열 (real_T, n개)
+ */
+void EKF_Smoother_StoreSoC(void* context, size_t k, const EKF_State_T* state, const real_T* P);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EKF_SMOOTHER_H */
@@ -15,6 +15,7 @@
 #define LOOKUP_TABLE_H
 
 #include "rtwtypes.h"
+#include "mem_account.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,6 +26,7 @@ typedef struct {
     real_T* breakpoints;            /* 중단점 배열 (x축) */
     real_T* table_data;             /* 테이블 데이터 배열 (y축) */
     uint32_T num_points;            /* 데이터 포인트 개수 */
+    Mem_Account_T memory;           /* 복사본 할당 계정 (초기화 후 봉인) */
     boolean_T initialized;          /* 초기화 완료 플래그 */
 } LookupTable_T;
 
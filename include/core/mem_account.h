@@ -0,0 +1,124 @@
+/*
+ * mem_account.h
+ *
+ * 할당 계정 모듈
+ * 라이브러리의 모든 힙 할당(RLS 버퍼, Lookup Table 복사본, 오프라인 작업 공간 등)을
+ * 이 모듈로 처리하여 인스턴스별 / 전체 바이트와 할당 횟수를 집계
+ *
+ * 인스턴스 계정:
+ * - RLS_T, LookupTable_T, RLS_Async_T는 자기 계정(Mem_Account_T)을 내장하고
+ *   초기화가 끝나면 봉인(Mem_Seal)
+ * - 봉인된 계정에 할당하면 위반으로 기록하고, 엄격 모드(Mem_SetStrict)에서는
+ *   메시지를 출력하고 abort (초기화 이후 할당 없음 검증용 디버그 모드)
+ * - 해제는 봉인과 관계없이 허용
+ *
+ * 인스턴스가 없는 일회성 작업 공간(EKF_FilterParallel, EKF_Smooth, 파일 읽기 등)은
+ * 계정 NULL로 할당하며 전체 집계(Mem_GetGlobal)에만 반영
+ *
+ * 각 블록 앞에 크기 헤더(MEM_HEADER_SIZE 바이트)를 두므로 해제 시 크기를 넘길 필요가
+ * 없고, Mem_Alloc / Mem_Calloc / Mem_Realloc의 반환 주소는 malloc과 같은 정렬을 가짐
+ */
+
+#ifndef MEM_ACCOUNT_H
+#define MEM_ACCOUNT_H
+
+#include "rtwtypes.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define MEM_HEADER_SIZE            16      /* 블록 헤더 크기 (바이트, malloc 정렬 유지) */
+
+/* 할당 계정 */
+typedef struct {
+    size_t bytes;                  /* 현재 사용 중인 바이트 (헤더 제외) */
+    size_t peak_bytes;             /* 최대 사용 바이트 */
+    uint32_T allocations;          /* 누적 할당 횟수 */
+    uint32_T frees;                /* 누적 해제 횟수 */
+    uint32_T violations;           /* 봉인 후 할당 횟수 */
+    boolean_T sealed;              /* 초기화 완료 (이후 할당은 위반) */
+} Mem_Account_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 할당 (malloc과 같은 정렬)
+ * @param account 계정 (NULL이면 전체 집계에만 반영)
+ * @param bytes 크기 (바이트)
+ * @return 할당된 메모리 (실패 시 NULL)
+ */
+void* Mem_Alloc(Mem_Account_T* account, size_t bytes);
+
+/**
+ * @brief 0으로 초기화된 배열 할당
+ * @param account 계정 (NULL 허용)
+ * @param count 요소 개수
+ * @param size 요소 크기 (바이트)
+ * @return 할당된 메모리 (실패 또는 크기 넘침 시 NULL)
+ */
+void* Mem_Calloc(Mem_Account_T* account, size_t count, size_t size);
+
+/**
+ * @brief 정렬된 할당
+ * @param account 계정 (NULL 허용)
+ * @param alignment 정렬 (2의 거듭제곱, MEM_HEADER_SIZE 이상)
+ * @param bytes 크기 (바이트)
+ * @return 할당된 메모리 (실패 시 NULL, Mem_Realloc 불가)
+ */
+void* Mem_AlignedAlloc(Mem_Account_T* account, size_t alignment, size_t bytes);
+
+/**
+ * @brief 크기 변경 (realloc과 같음, 크기를 늘리면 할당 한 번으로 셈)
+ * @param account 할당에 사용한 계정 (NULL 허용)
+ * @param data 기존 메모리 (NULL이면 Mem_Alloc)
+ * @param bytes 새 크기 (바이트)
+ * @return 새 메모리 (실패 시 NULL, 기존 메모리는 유지)
+ */
+void* Mem_Realloc(Mem_Account_T* account, void* data, size_t bytes);
+
+/**
+ * @brief 해제
+ * @param account 할당에 사용한 계정 (NULL 허용)
+ * @param data 메모리 (NULL이면 무시)
+ */
+void Mem_Free(Mem_Account_T* account, void* data);
+
+/**
+ * @brief 계정 초기화 (집계 0, 봉인 해제)
+ * @param account 계정
+ */
+void Mem_Reset(Mem_Account_T* account);
+
+/**
+ * @brief 계정 봉인 (초기화 완료 표시, 이후 할당은 위반)
+ * @param account 계정
+ */
+void Mem_Seal(Mem_Account_T* account);
+
+/**
+ * @brief 계정 합산 (셀 / 플릿 단위 집계용, 봉인 상태는 모두 봉인일 때만 유지)
+ * @param total 누적 계정
+ * @param part 더할 계정
+ */
+void Mem_Accumulate(Mem_Account_T* total, const Mem_Account_T* part);
+
+/**
+ * @brief 프로세스 전체 집계 (모든 계정 + 계정 없는 할당, 스레드 안전)
+ * @param global 출력 계정
+ */
+void Mem_GetGlobal(Mem_Account_T* global);
+
+/**
+ * @brief 엄격 모드 설정 (봉인된 계정에 할당하면 abort)
+ * @param strict 사용 여부
+ */
+void Mem_SetStrict(boolean_T strict);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEM_ACCOUNT_H */
@@ -0,0 +1,144 @@
+/*
+ * perf_counters.h
+ *
+ * 하드웨어 성능 카운터 모듈 (벤치마크 구간 측정용)
+ * Linux perf_event_open으로 사이클 / 명령어 / L1D 읽기 미스 / LLC 미스 / 분기 예측 실패를
+ * 구간 단위로 세어 IPC와 스텝당 미스 수를 계산
+ *
+ * 동작:
+ * - 사용자 공간만 측정 (exclude_kernel / exclude_hv)하므로 perf_event_paranoid 2에서도 열림
+ * - 이벤트마다 따로 열어 일부만 지원되어도 나머지는 측정 (가상 머신은 캐시 이벤트가
+ *   없는 경우가 많음). 카운터가 부족해 다중화되면 실행 시간 비율로 보정
+ * - 측정 구간에서 만든 스레드도 함께 셈 (inherit)
+ * - 컨테이너 / 권한 부족 / Linux 외 플랫폼에서는 Perf_Open이 false를 반환하고
+ *   Perf_Start / Perf_Stop은 아무것도 하지 않음 (결과는 모두 valid = false).
+ *   0으로 초기화만 한 구조체도 같은 상태로 취급하므로 열지 않고 그대로 넘겨도 됨
+ *
+ * 벤치마크 도구는 환경 변수 PERF_ENV_NAME(SOC_PERF)이 1일 때만 카운터를 엶
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include "rtwtypes.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define PERF_ENV_NAME              "SOC_PERF"  /* 1이면 벤치마크 도구가 카운터 사용 */
+
+/* 측정 이벤트 */
+typedef enum {
+    PERF_CYCLES = 0,               /* 코어 사이클 */
+    PERF_INSTRUCTIONS,             /* 완료 명령어 */
+    PERF_L1D_MISSES,               /* L1 데이터 캐시 읽기 미스 */
+    PERF_LLC_MISSES,               /* 마지막 단계 캐시 미스 */
+    PERF_BRANCH_MISSES,            /* 분기 예측 실패 */
+    PERF_EVENTS
+} Perf_Event_T;
+
+/* 열린 카운터 */
+typedef struct {
+    int32_T fd[PERF_EVENTS];       /* 이벤트별 파일 기술자 (-1이면 사용 불가) */
+    uint32_T opened;               /* 열린 이벤트 수 */
+    int32_T error;                 /* 첫 실패의 errno (모두 열렸으면 0) */
+} Perf_Counters_T;
+
+/* 구간 측정 결과 (여러 구간 누적 가능) */
+typedef struct {
+    real_T value[PERF_EVENTS];     /* 다중화 보정한 이벤트 수 */
+    boolean_T valid[PERF_EVENTS];  /* 측정 여부 */
+    real_T running_ratio;          /* 실제 측정 시간 / 활성 시간 최솟값 (1이면 다중화 없음) */
+} Perf_Sample_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 벤치마크 도구에서 카운터를 쓸지 여부 (환경 변수 SOC_PERF=1)
+ * @return 요청 여부
+ */
+boolean_T Perf_Requested(void);
+
+/**
+ * @brief 카운터 열기 (호출 스레드, 비활성 상태로 열림)
+ * @param counters 카운터 구조체 포인터
+ * @return 하나 이상 열렸는지 여부
+ */
+boolean_T Perf_Open(Perf_Counters_T* counters);
+
+/**
+ * @brief 카운터 닫기
+ * @param counters 카운터 구조체 포인터 (열지 않은 0 초기화 구조체 / 실패했어도 됨)
+ */
+void Perf_Close(Perf_Counters_T* counters);
+
+/**
+ * @brief 구간 시작 (0으로 초기화 후 활성화)
+ * @param counters 카운터 구조체 포인터
+ */
+void Perf_Start(Perf_Counters_T* counters);
+
+/**
+ * @brief 구간 끝 (비활성화 후 읽어서 sample에 더함)
+ * @param counters 카운터 구조체 포인터
+ * @param sample 누적할 결과 (처음에는 Perf_Reset, NULL이면 비활성화만)
+ */
+void Perf_Stop(Perf_Counters_T* counters, Perf_Sample_T* sample);
+
+/**
+ * @brief 결과 초기화
+ * @param sample 결과 포인터
+ */
+void Perf_Reset(Perf_Sample_T* sample);
+
+/**
+ * @brief 카운터 상태 설명 (예: "5/5 이벤트", "사용 불가: perf_event_paranoid")
+ * @param counters 카운터 구조체 포인터
+ * @return 상태 문자열 (내부 정적 버퍼, 스레드 안전 아님)
+ */
+const char* Perf_Describe(const Perf_Counters_T* counters);
+
+/**
+ * @brief IPC (명령어 / 사이클)
+ * @param sample 결과 포인터
+ * @return IPC (측정하지 못했으면 음수)
+ */
+real_T Perf_GetIPC(const Perf_Sample_T* sample);
+
+/**
+ * @brief 단위(스텝 / 연산)당 이벤트 수
+ * @param sample 결과 포인터
+ * @param event 이벤트
+ * @param units 단위 수
+ * @return 단위당 이벤트 수 (측정하지 못했으면 음수)
+ */
+real_T Perf_GetPerUnit(const Perf_Sample_T* sample, Perf_Event_T event, real_T units);
+
+/**
+ * @brief 한 줄 요약 출력 ("IPC 2.41, L1D 0.52, LLC 0.001, 분기 1.30 /단위", 없는 값은 n/a)
+ * @param out 출력 스트림
+ * @param sample 결과 포인터
+ * @param units 단위 수
+ * @param unit 단위 이름 (예: "스텝")
+ */
+void Perf_PrintSummary(FILE* out, const Perf_Sample_T* sample, real_T units, const char* unit);
+
+/**
+ * @brief JSON 객체 출력 (측정하지 못한 값은 null)
+ * {"ipc": .., "cycles": .., "instructions": .., "l1d_misses": .., "llc_misses": ..,
+ *  "branch_misses": .., "running_ratio": ..} (이벤트 수는 단위당 값)
+ * @param out 출력 스트림
+ * @param sample 결과 포인터
+ * @param units 단위 수
+ */
+void Perf_PrintJson(FILE* out, const Perf_Sample_T* sample, real_T units);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_COUNTERS_H */
@@ -9,17 +9,23 @@
  * - 칼만 게인 계산 (Kalman Gain)
  * - 파라미터 업데이트 (Parameter Update)
  * - 공분산 업데이트 (Covariance Update)
+ * - 블록 업데이트 (샘플 k개를 행렬 역변환 보조정리로 한 번에 처리)
  */
 
 #ifndef RLS_H
 #define RLS_H
 
 #include "rtwtypes.h"
+#include "mem_account.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* 상수 정의 */
+#define RLS_BLOCK_SIZE             32      /* 블록 업데이트 한 번에 처리하는 최대 샘플 수 */
+#define RLS_BLOCK_MAX_PARAMETERS   8       /* 블록 업데이트 최대 파라미터 개수 */
+
 /* RLS 파라미터 구조체 */
 typedef struct {
     real_T lambda;                  /* 망각 인자 (Forgetting Factor) */
@@ -27,6 +33,13 @@ typedef struct {
     uint32_T max_parameters;        /* 최대 파라미터 개수 */
 } RLS_Params_T;
 
+/* 여기(excitation) 기반 업데이트 생략 설정 구조체 */
+typedef struct {
+    boolean_T enable;               /* 모드 사용 여부 */
+    real_T min_information;         /* phi^T * P * phi 하한 (미만이면 새 정보가 없다고 판단) */
+    uint32_T decimation;            /* 정보 부족 구간에서도 N 샘플마다 한 번 업데이트 (0이면 모두 생략) */
+} RLS_Excitation_T;
+
 /* RLS 내부 상태 구조체 */
 typedef struct {
     real_T* P;                      /* 공분산 행렬 (동적 할당) */
@@ -34,10 +47,13 @@ typedef struct {
     real_T* phi;                    /* 회귀 벡터 */
     real_T* K;                      /* 칼만 게인 */
     real_T* P_phi;                  /* P * phi 계산 결과 */
-    real_T* phi_transpose;          /* phi 전치 */
     real_T innovation;              /* 혁신 (Innovation) */
     real_T innovation_covariance;   /* 혁신 공분산 */
     uint32_T num_parameters;        /* 실제 파라미터 개수 */
+    uint32_T update_count;          /* 수행한 업데이트 수 */
+    uint32_T skip_count;            /* 여기 부족으로 생략한 업데이트 수 */
+    uint32_T low_excitation_run;    /* 연속으로 생략한 샘플 수 (솎아내기용) */
+    Mem_Account_T memory;           /* 버퍼 할당 계정 (초기화 후 봉인) */
     boolean_T initialized;          /* 초기화 완료 플래그 */
 } RLS_Internal_T;
 
@@ -45,6 +61,7 @@ typedef struct {
 typedef struct {
     RLS_Params_T params;            /* RLS 파라미터 */
     RLS_Internal_T internal;        /* 내부 상태 */
+    RLS_Excitation_T excitation;    /* 여기 기반 업데이트 생략 설정 */
 } RLS_T;
 
 /* 함수 선언 */
@@ -64,6 +81,26 @@ boolean_T RLS_Initialize(RLS_T* rls, const RLS_Params_T* params, uint32_T num_pa
  */
 void RLS_Cleanup(RLS_T* rls);
 
+/**
+ * @brief 여기 기반 업데이트 생략 설정
+ * phi^T * P * phi (이 회귀 벡터 방향의 불확실성)가 min_information보다 작으면
+ * 새 정보가 거의 없다고 보고 RLS_Update를 생략(또는 decimation 샘플마다 한 번만 수행).
+ * 생략한 샘플은 망각도 적용하지 않으므로 휴지 구간의 공분산 폭주(wind-up)도 막음.
+ * RLS_UpdateBlock에는 적용되지 않음 (블록의 샘플은 판정 없이 모두 적용)
+ * @param rls RLS 구조체 포인터
+ * @param config 모드 설정 (enable이 false이면 모드 해제)
+ */
+void RLS_SetExcitation(RLS_T* rls, const RLS_Excitation_T* config);
+
+/**
+ * @brief 업데이트 수행 / 생략 횟수 반환
+ * RLS_UpdateBlock으로 처리한 샘플은 모두 수행한 업데이트로 집계
+ * @param rls RLS 구조체 포인터
+ * @param updated 출력: 수행한 업데이트 수 (NULL 가능)
+ * @param skipped 출력: 생략한 업데이트 수 (NULL 가능)
+ */
+void RLS_GetUpdateCounts(const RLS_T* rls, uint32_T* updated, uint32_T* skipped);
+
 /**
  * @brief RLS 파라미터 추정 실행
  * @param rls RLS 구조체 포인터
@@ -72,6 +109,22 @@ void RLS_Cleanup(RLS_T* rls);
  */
 void RLS_Update(RLS_T* rls, const real_T* phi, real_T y);
 
+/**
+ * @brief RLS 블록 업데이트 (샘플 k개를 한 번에 처리)
+ * 샘플별 망각을 포함한 RLS_Update k회와 같은 결과를 행렬 역변환 보조정리로 계산
+ *   S = Phi * P * Phi^T + diag(lambda^1 .. lambda^k),  G = P * Phi^T * S^-1
+ *   theta += G * (y - Phi * theta),  P = (P - G * Phi * P) / lambda^k
+ * S는 k x k Cholesky로 풀고, 행렬-행렬 연산으로 샘플당 비용을 분할 상환.
+ * k가 RLS_BLOCK_SIZE보다 크면 RLS_BLOCK_SIZE씩 나누어 처리하며, 공분산 대각 하한은
+ * 블록 끝에서 한 번만 적용. 파라미터가 RLS_BLOCK_MAX_PARAMETERS보다 많으면 샘플 단위 반복.
+ * 여기 기반 생략은 적용하지 않으며, k개 샘플 모두 update_count에 더함
+ * @param rls RLS 구조체 포인터
+ * @param Phi 회귀 벡터 행렬 (k x num_parameters, row-major)
+ * @param y 측정값 배열 (k)
+ * @param k 샘플 개수
+ */
+void RLS_UpdateBlock(RLS_T* rls, const real_T* Phi, const real_T* y, uint32_T k);
+
 /**
  * @brief 현재 파라미터 값 반환
  * @param rls RLS 구조체 포인터
@@ -0,0 +1,96 @@
+/*
+ * rls_async.h
+ *
+ * 비동기 RLS 모듈
+ * RLS 업데이트를 별도 작업 스레드에서 실행하여 스텝 스레드의 지연을
+ * Lookup + EKF 수준으로 낮춤
+ *
+ * 구조:
+ * - 스텝 스레드 -> 작업 스레드: 단일 생산자/단일 소비자 (SPSC) 링 버퍼로 (phi, y) 전달
+ * - 작업 스레드 -> 스텝 스레드: 시퀀스 락 (seqlock)으로 최신 theta 게시
+ * - 양방향 모두 잠금 없이 동작하며 스텝 스레드는 블록되지 않음
+ *   (링이 가득 차면 샘플을 버리고 개수만 기록)
+ *
+ * POSIX 스레드가 없는 플랫폼에서는 RLS_Async_Create가 NULL을 반환
+ */
+
+#ifndef RLS_ASYNC_H
+#define RLS_ASYNC_H
+
+#include "rtwtypes.h"
+#include "rls.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define RLS_ASYNC_QUEUE_SIZE       256     /* 링 버퍼 크기 (2의 거듭제곱) */
+#define RLS_ASYNC_MAX_PARAMETERS   8       /* 최대 파라미터 개수 */
+
+/* 비동기 RLS (구현 내부 구조체) */
+typedef struct RLS_Async_T RLS_Async_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 비동기 RLS 생성 및 작업 스레드 시작
+ * @param params RLS 파라미터
+ * @param num_parameters 파라미터 개수 (1 .. RLS_ASYNC_MAX_PARAMETERS)
+ * @return 비동기 RLS 포인터 (실패 시 NULL)
+ */
+RLS_Async_T* RLS_Async_Create(const RLS_Params_T* params, uint32_T num_parameters);
+
+/**
+ * @brief 작업 스레드 종료 및 해제
+ * 링에 남은 샘플은 처리하지 않고 버림
+ * @param async 비동기 RLS 포인터
+ */
+void RLS_Async_Destroy(RLS_Async_T* async);
+
+/**
+ * @brief 회귀 샘플 게시 (스텝 스레드, 블록되지 않음)
+ * @param async 비동기 RLS 포인터
+ * @param phi 회귀 벡터 (num_parameters)
+ * @param y 측정값
+ * @return 게시 성공 여부 (링이 가득 차면 false, 샘플은 버려짐)
+ */
+boolean_T RLS_Async_Post(RLS_Async_T* async, const real_T* phi, real_T y);
+
+/**
+ * @brief 최신 파라미터 읽기 (스텝 스레드, 찢어진 읽기 없음)
+ * @param async 비동기 RLS 포인터
+ * @param theta 출력 파라미터 벡터
+ * @param num_parameters 읽을 파라미터 개수
+ * @return 읽은 theta에 반영된 누적 샘플 수
+ */
+uint32_T RLS_Async_GetParameters(const RLS_Async_T* async, real_T* theta, uint32_T num_parameters);
+
+/**
+ * @brief 게시한 샘플이 모두 반영될 때까지 대기 (테스트 / 종료 전 동기화용)
+ * @param async 비동기 RLS 포인터
+ */
+void RLS_Async_Flush(RLS_Async_T* async);
+
+/**
+ * @brief 링이 가득 차서 버려진 샘플 수
+ * RLS_Async_Post가 false를 반환한 호출 수 (생성 이후 누적). 작업 스레드가 처리한 샘플 수가
+ * 아니며, 처리된 샘플 수는 RLS_Async_GetParameters의 반환값으로 확인
+ * @param async 비동기 RLS 포인터
+ * @return 버려진 샘플 수
+ */
+uint32_T RLS_Async_GetDropped(const RLS_Async_T* async);
+
+/**
+ * @brief 할당 계정 (구조체 + 작업 스레드 RLS 버퍼)
+ * 작업 스레드는 초기화 이후 할당하지 않으므로 스텝 스레드에서 읽어도 됨
+ * @param async 비동기 RLS 포인터
+ * @param memory 누적할 계정 (Mem_Accumulate)
+ */
+void RLS_Async_GetMemory(const RLS_Async_T* async, Mem_Account_T* memory);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RLS_ASYNC_H */
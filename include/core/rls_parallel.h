@@ -0,0 +1,51 @@
+/*
+ * rls_parallel.h
+ *
+ * 병렬 RLS 일괄 식별 모듈 (오프라인 로그 처리용)
+ * 망각 인자 lambda가 고정이면 RLS의 정보 행렬과 정보 벡터는 지수 가중 합
+ *
+ *   P_n^-1         = lambda^n * P_0^-1         + sum_k lambda^(n-k) * phi_k * phi_k^T
+ *   P_n^-1 theta_n = lambda^n * P_0^-1 theta_0 + sum_k lambda^(n-k) * phi_k * y_k
+ *
+ * 이므로 기록을 청크로 나누어 스레드별로 부분합을 구하고, 청크 끝에서 기록 끝까지의
+ * lambda 거듭제곱으로 가중하여 합친 뒤 Cholesky 분해로 theta, P를 계산
+ */
+
+#ifndef RLS_PARALLEL_H
+#define RLS_PARALLEL_H
+
+#include "rtwtypes.h"
+#include "rls.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define RLS_PARALLEL_MAX_THREADS     64      /* 최대 작업 스레드(청크) 개수 */
+#define RLS_PARALLEL_MAX_PARAMETERS  8       /* 최대 파라미터 개수 */
+#define RLS_PARALLEL_MIN_CHUNK       4096    /* 청크당 최소 샘플 수 */
+
+/* 함수 선언 */
+
+/**
+ * @brief 기록 전체로 RLS 파라미터를 병렬 식별
+ * rls의 현재 theta, P를 사전값으로 하여 RLS_Update(rls, &phi[k * p], y[k])를
+ * k = 0 .. n-1 순서로 호출한 것과 같은 theta, P를 계산하고 rls에 반영.
+ * RLS_Update의 공분산 대각 하한(RLS_MIN_COVARIANCE)이 걸리지 않는 범위에서 동일
+ * @param rls RLS 구조체 포인터 (lambda, 사전 theta / P 사용)
+ * @param phi 회귀 벡터 배열 (n x num_parameters, row-major)
+ * @param y 측정값 배열 (n)
+ * @param n 샘플 개수
+ * @param num_threads 작업 스레드 개수 (0이면 온라인 코어 수)
+ * @return 성공 여부 (정보 행렬이 양의 정부호가 아니면 실패, rls는 변경되지 않음)
+ */
+boolean_T RLS_FitParallel(RLS_T* rls, const real_T* phi, const real_T* y, size_t n,
+                          uint32_T num_threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RLS_PARALLEL_H */
@@ -0,0 +1,120 @@
+/*
+ * rt_mode.h
+ *
+ * 실시간 실행 모드 모듈
+ * 주기 실행 루프 전에 스레드 / 메모리 / 부동소수점 환경을 실시간용으로 설정하고,
+ * 절대 시각 기준 주기 실행기로 스텝을 호출하면서 마감 시간 위반을 집계
+ *
+ * RT_Enter (초기화가 모두 끝난 뒤 호출):
+ * - mlockall(MCL_CURRENT | MCL_FUTURE): 현재 매핑된 페이지(셀 상태, 테이블 등)를
+ *   모두 메모리에 올려 고정하고 이후 할당도 고정 (페이지 폴트 제거)
+ * - glibc에서는 free가 메모리를 운영체제에 돌려주지 않도록 malloc 조정
+ *   (프로세스 전역 설정이고 glibc가 현재 값을 조회하는 방법이 없어 RT_Leave에서 복원하지 않음)
+ * - 스택을 prefault_stack 바이트만큼 미리 접근
+ * - CPU 고정, 권한이 있으면 SCHED_FIFO
+ * - 비정규 수(denormal)를 0으로 처리 (x86 FTZ / DAZ, AArch64 FZ)
+ *
+ * 요청한 항목이 권한 / 플랫폼 문제로 실패해도 나머지는 적용하고 결과를 RT_Status_T에 기록
+ * 셀 스텝 경로(SoC_Cell_Step)는 할당을 하지 않으므로 모든 할당은 초기화에서 끝남
+ *
+ * Linux 외 플랫폼에서는 적용 가능한 항목만 적용하고 RT_RunPeriodic은 false를 반환
+ */
+
+#ifndef RT_MODE_H
+#define RT_MODE_H
+
+#include "rtwtypes.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define RT_DEFAULT_PRIORITY        80              /* SCHED_FIFO 기본 우선순위 */
+#define RT_DEFAULT_STACK_PREFAULT  (256 * 1024)    /* 기본 스택 prefault 크기 (바이트) */
+#define RT_AFFINITY_BYTES          128             /* 저장할 CPU 집합 크기 (glibc cpu_set_t, 1024 CPU) */
+
+/* 실시간 모드 설정 */
+typedef struct {
+    int32_T cpu;                   /* 고정할 CPU (음수이면 고정하지 않음) */
+    int32_T priority;              /* SCHED_FIFO 우선순위 (0이면 스케줄링 정책 유지) */
+    boolean_T lock_memory;         /* mlockall로 메모리 고정 */
+    size_t prefault_stack;         /* 미리 접근할 스택 크기 (바이트, 0이면 생략) */
+    boolean_T flush_denormals;     /* 비정규 수를 0으로 처리 */
+} RT_Config_T;
+
+/* 적용 결과 및 RT_Leave 복원용 이전 상태 */
+typedef struct {
+    boolean_T pinned;              /* CPU 고정 성공 */
+    boolean_T fifo;                /* SCHED_FIFO 적용 성공 */
+    boolean_T memory_locked;       /* mlockall 성공 */
+    boolean_T denormals_flushed;   /* FTZ / DAZ 적용 성공 */
+
+    boolean_T affinity_saved;      /* 이전 CPU 집합 저장 성공 */
+    uint8_T saved_affinity[RT_AFFINITY_BYTES]; /* 이전 CPU 집합 (cpu_set_t) */
+    int32_T saved_policy;          /* 이전 스케줄링 정책 */
+    int32_T saved_priority;        /* 이전 우선순위 */
+    uint64_t saved_fp_control;     /* 이전 MXCSR / FPCR */
+} RT_Status_T;
+
+/* 주기 실행 통계 */
+typedef struct {
+    uint64_t steps;                /* 실행한 스텝 수 */
+    uint64_t deadline_misses;      /* 다음 주기 시작 시각까지 끝나지 않은 스텝 수 */
+    uint64_t skipped_periods;      /* 마감 위반으로 건너뛴 주기 수 */
+    real_T step_mean;              /* 스텝 실행 시간 평균 (s) */
+    real_T step_max;               /* 스텝 실행 시간 최대 (s) */
+    uint64_t step_max_index;       /* 최대 실행 시간 스텝 인덱스 */
+    real_T wakeup_max;             /* 예정 시각 대비 깨어난 지연 최대 (s) */
+} RT_Stats_T;
+
+/* 주기 실행 스텝 함수 (k: 0부터 시작하는 스텝 인덱스) */
+typedef void (*RT_StepFunction_T)(void* context, size_t k);
+
+/* 함수 선언 */
+
+/**
+ * @brief 실시간 모드 진입 (호출 스레드에 적용)
+ * @param config 설정
+ * @param status 출력 적용 결과 (RT_Leave에 전달)
+ * @return 요청한 항목이 모두 적용되었는지 여부
+ */
+boolean_T RT_Enter(const RT_Config_T* config, RT_Status_T* status);
+
+/**
+ * @brief 실시간 모드 해제 (CPU 집합 / 스케줄링 정책 / 부동소수점 제어 복원, 메모리 고정 해제)
+ * RT_Enter의 malloc 조정은 복원하지 않음 (프로세스 끝까지 유지)
+ * @param status RT_Enter가 기록한 상태
+ */
+void RT_Leave(const RT_Status_T* status);
+
+/**
+ * @brief 메모리 영역의 모든 페이지를 미리 접근 (값은 바꾸지 않음)
+ * mlockall 이후에 할당한 버퍼나 RT_Enter 전에 폴트를 일으키고 싶은 버퍼에 사용
+ * @param data 시작 주소
+ * @param bytes 크기 (바이트)
+ */
+void RT_Prefault(void* data, size_t bytes);
+
+/**
+ * @brief 절대 시각 기준 주기 실행 (clock_nanosleep, CLOCK_MONOTONIC)
+ * 스텝이 다음 주기 시작 시각을 넘기면 마감 위반으로 세고, 밀린 주기는
+ * 몰아서 실행하지 않고 건너뜀
+ * @param period 주기 (s, 보통 셀 설정의 sampling_time)
+ * @param steps 실행할 스텝 수
+ * @param step 스텝 함수
+ * @param context 스텝 함수에 전달할 포인터
+ * @param stats 출력 통계
+ * @return 실행 여부 (인자 오류, 지원하지 않는 플랫폼 또는 대기 실패이면 false,
+ *         대기 실패 시 stats에는 그때까지 실행한 스텝이 기록됨)
+ */
+boolean_T RT_RunPeriodic(real_T period, size_t steps, RT_StepFunction_T step, void* context,
+                         RT_Stats_T* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RT_MODE_H */
@@ -0,0 +1,215 @@
+/*
+ * soc_cell.h
+ *
+ * 셀 단위 SoC 추정 모듈
+ * EKF, RLS, Lookup Table을 한 셀의 인스턴스로 묶고 단계별 실행 주기를 관리
+ *
+ * 다중 속도 실행:
+ * - 전류 적분 (쿨롱 카운팅)은 매 입력 샘플마다 수행
+ * - OCV 조회, RLS 업데이트, EKF 측정 업데이트는 단계별로 k 샘플마다 또는 요청 시 수행
+ * - EKF 측정 업데이트 사이의 전류는 합과 개수만 누적했다가 EKF_PredictSum으로
+ *   한 번에 예측하므로 공분산 전파도 업데이트 주기로만 수행
+ *
+ * 주기는 셀마다 설정할 수 있어 대규모 플릿에서 정확도와 CPU 사용량을 조절 가능
+ *
+ * 파이프라인 모드 (rls_async):
+ * - RLS 단계는 (phi, y)를 작업 스레드에 게시만 하고, 파라미터는 SoC_Cell_GetParameters가
+ *   작업 스레드의 최신 게시값을 읽음 (rls_async.h)
+ *
+ * 단계별 시간 측정 (SOC_PROFILE 정의 시, make PROFILE=1):
+ * - SOC_CELL_PROFILE_PERIOD 샘플마다 한 스텝만 단계 경계에서 타임스탬프를 읽어
+ *   (x86은 TSC, 그 외는 clock_gettime ns) 셀별 카운터에 누적
+ * - 표본 추출이므로 타임스탬프 비용이 스텝 전체에 나뉘어 오버헤드는 1% 미만
+ * - 정의하지 않으면 측정 코드는 컴파일되지 않고 카운터는 0으로 유지
+ */
+
+#ifndef SOC_CELL_H
+#define SOC_CELL_H
+
+#include "rtwtypes.h"
+#include <stdint.h>
+#include "ekf.h"
+#include "rls.h"
+#include "rls_async.h"
+#include "lookup_table.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define SOC_CELL_RLS_PARAMETERS    3       /* RLS 파라미터 개수 [상수항, 전류, SoC] */
+
+/* 실행 단계 (요청 비트 마스크) */
+#define SOC_CELL_STAGE_LOOKUP      0x01u   /* OCV, dOCV/dSOC 조회 */
+#define SOC_CELL_STAGE_RLS         0x02u   /* RLS 파라미터 업데이트 */
+#define SOC_CELL_STAGE_UPDATE      0x04u   /* EKF 측정 업데이트 */
+#define SOC_CELL_STAGE_ALL         0x07u   /* 모든 단계 */
+
+/* 시간 측정 표본 주기 (2의 거듭제곱, 스텝 수) */
+#ifndef SOC_CELL_PROFILE_PERIOD
+#define SOC_CELL_PROFILE_PERIOD    64
+#endif
+
+/* 시간 측정 구간 (SoC_Cell_Profile_T의 stage 인덱스) */
+typedef enum {
+    SOC_CELL_PROFILE_OCV = 0,      /* OCV 보간 */
+    SOC_CELL_PROFILE_DOCV,         /* dOCV/dSOC 보간 */
+    SOC_CELL_PROFILE_RLS,          /* RLS 업데이트 (파이프라인 모드는 게시) */
+    SOC_CELL_PROFILE_EKF,          /* 전류 적분 + EKF 예측 / 측정 업데이트 */
+    SOC_CELL_PROFILE_CLAMP,        /* 쿨롱 카운팅 SoC 계산 및 범위 제한 (스텝당 2회) */
+    SOC_CELL_PROFILE_STAGES
+} SoC_Cell_ProfileStage_T;
+
+/* 구간별 누적 카운터 */
+typedef struct {
+    uint64_t ticks;                /* 누적 시간 (SoC_Cell_Profile_T.unit) */
+    uint64_t calls;                /* 측정한 실행 횟수 */
+} SoC_Cell_ProfileCounter_T;
+
+/* 단계별 시간 측정 결과 */
+typedef struct {
+    SoC_Cell_ProfileCounter_T stage[SOC_CELL_PROFILE_STAGES];
+    SoC_Cell_ProfileCounter_T step; /* 측정한 스텝 전체 */
+    uint32_T period;               /* 표본 주기 (측정이 컴파일되지 않았으면 0) */
+    const char* unit;              /* 시간 단위 ("TSC" 또는 "ns") */
+} SoC_Cell_Profile_T;
+
+/* 단계별 실행 주기 (샘플 수, 1이면 매 샘플, 0이면 요청 시에만) */
+typedef struct {
+    uint32_T lookup_every;         /* OCV 조회 주기 */
+    uint32_T rls_every;            /* RLS 업데이트 주기 */
+    uint32_T update_every;         /* EKF 측정 업데이트 주기 */
+} SoC_Schedule_T;
+
+/* 셀 설정 구조체 */
+typedef struct {
+    real_T sampling_time;          /* 입력 샘플링 시간 (s) */
+    real_T battery_capacity;       /* 배터리 용량 (Ah) */
+    EKF_Params_T ekf;              /* EKF 파라미터 */
+    EKF_SteadyState_T ekf_steady;  /* EKF 정상 상태 게인 모드 설정 */
+    const struct EKF_GainTable_T* ekf_gain_table; /* EKF 게인 스케줄링 테이블 (NULL이면 미사용,
+                                                      셀보다 오래 유지되어야 함) */
+    RLS_Params_T rls;              /* RLS 파라미터 */
+    RLS_Excitation_T rls_excitation; /* RLS 여기 기반 업데이트 생략 설정 (동기 모드) */
+    const real_T* soc_breakpoints; /* SoC 중단점 (table_points) */
+    const real_T* ocv_data;        /* OCV 테이블 (table_points) */
+    const real_T* docv_data;       /* dOCV/dSOC 테이블 (table_points) */
+    uint32_T table_points;         /* 테이블 데이터 포인트 개수 */
+    SoC_Schedule_T schedule;       /* 단계별 실행 주기 */
+    boolean_T rls_async;           /* RLS를 작업 스레드에서 실행 (파이프라인 모드) */
+} SoC_Cell_Config_T;
+
+/* 셀 구조체 */
+typedef struct {
+    EKF_T ekf;                     /* Extended Kalman Filter */
+    RLS_T rls;                     /* Recursive Least Squares (동기 모드) */
+    RLS_Async_T* rls_async;        /* 비동기 RLS (파이프라인 모드, 아니면 NULL) */
+    LookupTable_T ocv_table;       /* OCV Lookup Table */
+    LookupTable_T docv_table;      /* dOCV/dSOC Lookup Table */
+
+    /* 셀 상태 */
+    real_T current;                /* 현재 전류 */
+    real_T voltage;                /* 현재 전압 */
+    real_T soc;                    /* 현재 SoC (쿨롱 카운팅 반영) */
+    real_T temperature;            /* 현재 온도 */
+    real_T ocv;                    /* 마지막 조회 OCV */
+    real_T docv_dsoc;              /* 마지막 조회 dOCV/dSOC */
+
+    /* 셀 파라미터 */
+    real_T sampling_time;          /* 샘플링 시간 */
+    real_T battery_capacity;       /* 배터리 용량 */
+
+    /* 다중 속도 스케줄러 상태 */
+    SoC_Schedule_T schedule;       /* 단계별 실행 주기 */
+    uint32_T sample_count;         /* 누적 입력 샘플 수 */
+    uint32_T requested;            /* 다음 스텝에 강제 실행할 단계 (비트 마스크) */
+    real_T pending_current_sum;    /* 측정 업데이트 대기 중인 전류 합 */
+    uint32_T pending_steps;        /* 측정 업데이트 대기 중인 샘플 수 */
+
+    /* 단계별 시간 측정 (SOC_PROFILE) */
+    SoC_Cell_ProfileCounter_T profile_stage[SOC_CELL_PROFILE_STAGES];
+    SoC_Cell_ProfileCounter_T profile_step;
+
+    boolean_T initialized;         /* 초기화 완료 플래그 */
+} SoC_Cell_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 셀 초기화
+ * @param cell 셀 구조체 포인터
+ * @param config 셀 설정
+ * @return 초기화 성공 여부
+ */
+boolean_T SoC_Cell_Initialize(SoC_Cell_T* cell, const SoC_Cell_Config_T* config);
+
+/**
+ * @brief 셀 해제 (메모리 정리)
+ * @param cell 셀 구조체 포인터
+ */
+void SoC_Cell_Cleanup(SoC_Cell_T* cell);
+
+/**
+ * @brief 셀 한 스텝 실행 (입력 샘플 하나)
+ * @param cell 셀 구조체 포인터
+ * @param current 입력 전류 (A)
+ * @param voltage 입력 전압 (V)
+ * @return 출력 SoC
+ */
+real_T SoC_Cell_Step(SoC_Cell_T* cell, real_T current, real_T voltage);
+
+/**
+ * @brief 최신 RLS 파라미터 읽기
+ * 파이프라인 모드에서는 작업 스레드가 마지막으로 게시한 값
+ * @param cell 셀 구조체 포인터
+ * @param theta 출력 파라미터 벡터 (SOC_CELL_RLS_PARAMETERS)
+ */
+void SoC_Cell_GetParameters(const SoC_Cell_T* cell, real_T* theta);
+
+/**
+ * @brief 단계별 실행 주기 변경
+ * @param cell 셀 구조체 포인터
+ * @param schedule 새 실행 주기
+ */
+void SoC_Cell_SetSchedule(SoC_Cell_T* cell, const SoC_Schedule_T* schedule);
+
+/**
+ * @brief 다음 스텝에서 주기와 관계없이 단계 실행 요청
+ * @param cell 셀 구조체 포인터
+ * @param stages 실행할 단계 (SOC_CELL_STAGE_* 비트 마스크)
+ */
+void SoC_Cell_Request(SoC_Cell_T* cell, uint32_T stages);
+
+/**
+ * @brief 단계별 시간 측정 결과 읽기
+ * @param cell 셀 구조체 포인터
+ * @param profile 출력 측정 결과 (SOC_PROFILE 없이 빌드했으면 period 0, 카운터 0)
+ */
+void SoC_Cell_GetProfile(const SoC_Cell_T* cell, SoC_Cell_Profile_T* profile);
+
+/**
+ * @brief 단계별 시간 측정 카운터 초기화
+ * @param cell 셀 구조체 포인터
+ */
+void SoC_Cell_ResetProfile(SoC_Cell_T* cell);
+
+/**
+ * @brief 셀이 소유한 힙 할당 집계 (RLS 버퍼, 두 Lookup Table, 비동기 RLS)
+ * 셀 구조체 자체(sizeof(SoC_Cell_T))는 호출자가 소유하므로 포함하지 않음
+ * @param cell 셀 구조체 포인터
+ * @param memory 출력 계정 (모든 계정이 봉인되었으면 sealed)
+ */
+void SoC_Cell_GetMemory(const SoC_Cell_T* cell, Mem_Account_T* memory);
+
+/**
+ * @brief 셀 상태 출력 (디버깅용, EKF / RLS 상태와 단계별 측정 결과 포함)
+ * @param cell 셀 구조체 포인터
+ */
+void SoC_Cell_PrintStatus(const SoC_Cell_T* cell);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOC_CELL_H */
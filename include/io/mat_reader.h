@@ -0,0 +1,85 @@
+/*
+ * mat_reader.h
+ *
+ * MAT 5.0 파일 읽기 모듈 (WSN9.mat 등 측정 기록 재생용)
+ * MATLAB/Python으로 CSV를 거치지 않고 .mat 파일의 수치 배열을 변수 이름으로 읽음
+ *
+ * 구조:
+ * - 파일은 mmap으로 매핑하고, 열 때 최상위 요소를 훑어 변수 이름 / 형식 / 크기만 색인
+ * - 비압축 double 배열(miMATRIX + miDOUBLE)은 매핑된 데이터를 그대로 가리킴 (복사 없음)
+ * - 압축 요소(miCOMPRESSED)는 처음 요청될 때 zlib으로 고정 크기 청크씩 스트리밍
+ *   압축 해제하여 real_T 버퍼에 직접 풀어 넣음 (요소 전체를 중간 버퍼에 두지 않음)
+ * - double이 아닌 수치 형식(정수 / single)은 real_T로 변환
+ *
+ * 지원 범위: 파일과 호스트의 바이트 순서가 같은 실수 수치 배열 (복소수 / 희소 / 셀 / 구조체 제외)
+ */
+
+#ifndef MAT_READER_H
+#define MAT_READER_H
+
+#include "rtwtypes.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define MAT_MAX_NAME               64      /* 변수 이름 최대 길이 (종료 문자 포함) */
+#define MAT_CHUNK_SIZE             16384   /* 스트리밍 압축 해제 / 변환 청크 크기 (바이트) */
+
+/* MAT 파일 (구현 내부 구조체) */
+typedef struct MAT_File_T MAT_File_T;
+
+/* 수치 배열 (열 우선 저장, MATLAB과 동일) */
+typedef struct {
+    const real_T* data;            /* 데이터 (rows x cols, MAT_Close 전까지 유효) */
+    size_t rows;                   /* 행 개수 */
+    size_t cols;                   /* 열 개수 (3차원 이상은 나머지 차원의 곱) */
+} MAT_Array_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief MAT 파일 열기 및 변수 색인
+ * @param path 파일 경로
+ * @return MAT 파일 포인터 (파일 오류 또는 MAT 5.0 형식이 아니면 NULL)
+ */
+MAT_File_T* MAT_Open(const char* path);
+
+/**
+ * @brief MAT 파일 닫기 (매핑 해제 및 압축 해제 버퍼 해제)
+ * @param file MAT 파일 포인터
+ */
+void MAT_Close(MAT_File_T* file);
+
+/**
+ * @brief 색인된 변수 개수
+ * @param file MAT 파일 포인터
+ * @return 변수 개수
+ */
+uint32_T MAT_GetVariableCount(const MAT_File_T* file);
+
+/**
+ * @brief 변수 이름
+ * @param file MAT 파일 포인터
+ * @param index 변수 인덱스 (0 .. MAT_GetVariableCount - 1)
+ * @return 변수 이름 (범위 밖이면 NULL)
+ */
+const char* MAT_GetVariableName(const MAT_File_T* file, uint32_T index);
+
+/**
+ * @brief 이름으로 실수 수치 배열 읽기
+ * 압축 요소는 첫 호출에서 압축 해제하고 이후 호출은 같은 버퍼를 반환
+ * @param file MAT 파일 포인터
+ * @param name 변수 이름
+ * @param array 출력 배열
+ * @return 성공 여부 (변수가 없거나 지원하지 않는 형식, 손상된 데이터이면 false)
+ */
+boolean_T MAT_GetDouble(MAT_File_T* file, const char* name, MAT_Array_T* array);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAT_READER_H */
@@ -0,0 +1,93 @@
+/*
+ * socbin.h
+ *
+ * .socbin 측정 기록 형식 모듈 (반복 벤치마크 / 튜닝 재생용)
+ * MAT 파일의 압축 해제 / 파싱 없이 mmap 한 번으로 열 단위 배열을 바로 사용
+ *
+ * 파일 구조 (버전 1, 호스트 바이트 순서):
+ *   0   magic[8]      "SOCBIN\0\0"
+ *   8   uint32 version
+ *   12  uint32 flags      (SOCBIN_FLAG_*: 선택 열 존재 여부)
+ *   16  uint64 count      (행 개수)
+ *   24  uint64 offset[5]  (열별 파일 오프셋, 없는 열은 0)
+ *   64  열 데이터         (각 열은 64바이트 경계에서 시작, 열 사이는 0으로 채움)
+ *
+ * 열: timestamp / current / voltage (필수, double), temperature (선택, double),
+ *     cell_id (선택, uint32)
+ * 파일 매핑은 페이지 경계에서 시작하므로 각 열 포인터는 64바이트 정렬이 보장되어
+ * EKF_FilterParallel, EKF_Smooth 등 배열 입력 API에 복사 없이 넘길 수 있음
+ */
+
+#ifndef SOCBIN_H
+#define SOCBIN_H
+
+#include "rtwtypes.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define SOCBIN_VERSION             1
+#define SOCBIN_HEADER_SIZE         64      /* 헤더 크기 (바이트) */
+#define SOCBIN_ALIGNMENT           64      /* 열 시작 정렬 (바이트) */
+
+/* 선택 열 플래그 */
+#define SOCBIN_FLAG_TEMPERATURE    0x1u
+#define SOCBIN_FLAG_CELL_ID        0x2u
+
+/* 매핑 힌트 (SOCBIN_Open의 hints, 지원하지 않는 플랫폼에서는 무시) */
+#define SOCBIN_HINT_SEQUENTIAL     0x1u    /* 순차 접근: 미리 읽기 확대 */
+#define SOCBIN_HINT_WILLNEED       0x2u    /* 열기 직후 전체 미리 읽기 */
+#define SOCBIN_HINT_HUGEPAGE       0x4u    /* 투명 대형 페이지 요청 */
+
+/* .socbin 파일 (구현 내부 구조체) */
+typedef struct SOCBIN_File_T SOCBIN_File_T;
+
+/* 열 배열 묶음 (쓰기 입력 / 읽기 출력 공용) */
+typedef struct {
+    const real_T* timestamp;       /* 시간 (s) */
+    const real_T* current;         /* 전류 (A) */
+    const real_T* voltage;         /* 전압 (V) */
+    const real_T* temperature;     /* 온도 (°C, 없으면 NULL) */
+    const uint32_T* cell_id;       /* 셀 ID (없으면 NULL) */
+    size_t count;                  /* 행 개수 */
+} SOCBIN_Columns_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief .socbin 파일 쓰기
+ * @param path 출력 파일 경로
+ * @param columns 열 배열 (timestamp / current / voltage 필수)
+ * @return 성공 여부
+ */
+boolean_T SOCBIN_Write(const char* path, const SOCBIN_Columns_T* columns);
+
+/**
+ * @brief .socbin 파일 열기 (mmap)
+ * @param path 파일 경로
+ * @param hints 매핑 힌트 (SOCBIN_HINT_* 조합, 0이면 힌트 없음)
+ * @return 파일 포인터 (파일 오류 또는 형식 / 버전 불일치 시 NULL)
+ */
+SOCBIN_File_T* SOCBIN_Open(const char* path, uint32_T hints);
+
+/**
+ * @brief .socbin 파일 닫기 (매핑 해제, 열 포인터 무효화)
+ * @param file 파일 포인터
+ */
+void SOCBIN_Close(SOCBIN_File_T* file);
+
+/**
+ * @brief 열 포인터 얻기 (매핑을 직접 가리킴, 복사 없음)
+ * @param file 파일 포인터
+ * @param columns 출력 열 배열 (없는 선택 열은 NULL)
+ */
+void SOCBIN_GetColumns(const SOCBIN_File_T* file, SOCBIN_Columns_T* columns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOCBIN_H */
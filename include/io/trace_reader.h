@@ -0,0 +1,90 @@
+/*
+ * trace_reader.h
+ *
+ * 측정 기록 열기 모듈 (재생 / 벤치마크 / 실시간 실행기 공용)
+ * 경로 확장자로 .socbin과 MAT 파일을 구분해 열고, 전류 / 전압 값 열 포인터와 스텝 수를 제공
+ *
+ * - .socbin: SOCBIN_Open으로 매핑한 열을 그대로 가리킴
+ * - MAT: current / voltage 변수 ([시간, 값] 2열, 1열이면 값만)의 마지막 열을 가리킴
+ *   (열 우선 저장이므로 복사 없이 값 열을 얻음, N x 0 빈 변수는 오류)
+ * 열 포인터는 TRACE_Close 전까지 유효
+ */
+
+#ifndef TRACE_READER_H
+#define TRACE_READER_H
+
+#include "rtwtypes.h"
+#include "mat_reader.h"
+#include "socbin.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define TRACE_CURRENT_NAME         "current"  /* MAT 기록의 전류 변수 이름 */
+#define TRACE_VOLTAGE_NAME         "voltage"  /* MAT 기록의 전압 변수 이름 */
+
+/* 열린 측정 기록 */
+typedef struct {
+    MAT_File_T* mat;               /* MAT 파일 (.socbin이면 NULL) */
+    SOCBIN_File_T* socbin;         /* .socbin 파일 (MAT이면 NULL) */
+    const real_T* current;         /* 전류 값 열 (A) */
+    const real_T* voltage;         /* 전압 값 열 (V) */
+    size_t steps;                  /* 스텝 수 (두 열 중 짧은 쪽) */
+} TRACE_Reader_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 경로가 .socbin 기록인지 확인 (확장자 기준)
+ * @param path 파일 경로
+ * @return .socbin 확장자 여부
+ */
+boolean_T TRACE_IsSocbin(const char* path);
+
+/**
+ * @brief 측정 기록 열기 (확장자로 .socbin / MAT 선택)
+ * @param path 파일 경로
+ * @param hints .socbin 매핑 힌트 (SOCBIN_HINT_* 조합, MAT에서는 무시)
+ * @param trace 출력 기록 (실패 시 0으로 초기화)
+ * @return 성공 여부
+ */
+boolean_T TRACE_Open(const char* path, uint32_T hints, TRACE_Reader_T* trace);
+
+/**
+ * @brief MAT 측정 기록 열기 (current / voltage 변수의 값 열)
+ * @param path MAT 파일 경로
+ * @param trace 출력 기록 (실패 시 0으로 초기화)
+ * @return 성공 여부 (파일 오류, 변수 없음 또는 빈 변수이면 false)
+ */
+boolean_T TRACE_OpenMat(const char* path, TRACE_Reader_T* trace);
+
+/**
+ * @brief .socbin 측정 기록 열기
+ * @param path .socbin 파일 경로
+ * @param hints 매핑 힌트 (SOCBIN_HINT_* 조합)
+ * @param trace 출력 기록 (실패 시 0으로 초기화)
+ * @return 성공 여부
+ */
+boolean_T TRACE_OpenSocbin(const char* path, uint32_T hints, TRACE_Reader_T* trace);
+
+/**
+ * @brief 측정 기록 닫기 (열 포인터 무효화)
+ * @param trace 기록
+ */
+void TRACE_Close(TRACE_Reader_T* trace);
+
+/**
+ * @brief [시간, 값] 배열의 값 열 (마지막 열, 1열이면 배열 자체)
+ * @param array MAT 수치 배열 (cols > 0)
+ * @return 값 열 포인터 (열이 없으면 NULL)
+ */
+const real_T* TRACE_ValueColumn(const MAT_Array_T* array);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_READER_H */
@@ -0,0 +1,150 @@
+/*
+ * cholesky.h
+ *
+ * 대칭 양의 정부호 (SPD) 선형 시스템 풀이 모듈
+ * Cholesky (A = L * L^T) 및 LDL^T (A = L * D * L^T) 분해와 풀이를 제공
+ * 역행렬을 직접 만들지 않고 블록 RLS, 큰 EKF 모델의 S * X = B 형태를 풀기 위함
+ *
+ * 저장 방식:
+ * - 행렬은 row-major, 분해는 제자리에서 하삼각(대각 포함)에만 기록
+ * - 상삼각은 읽지도 쓰지도 않음
+ * - LDL^T는 L의 단위 대각을 생략하고 대각 위치에 D를 저장
+ *
+ * 주요 기능:
+ * - 일반 차원 분해 / 풀이
+ * - 고정 크기 특수화 (n = 2 .. 8, 루프가 완전히 펼쳐짐)
+ * - SoA 배치 Cholesky (SIMD 레인 하나가 시스템 하나를 담당)
+ */
+
+#ifndef CHOLESKY_H
+#define CHOLESKY_H
+
+#include "rtwtypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 상수 정의 */
+#define CHOLESKY_MIN_FIXED_DIM    2       /* 고정 크기 특수화 최소 차원 */
+#define CHOLESKY_MAX_FIXED_DIM    8       /* 고정 크기 특수화 / 배치 최대 차원 */
+
+/* 함수 선언 */
+
+/**
+ * @brief Cholesky 분해: A = L * L^T (제자리, 하삼각에 L 기록)
+ * 차원이 2 .. 8이면 고정 크기 구현으로 분기
+ * @param A 입력 SPD 행렬 / 출력 L (dim x dim)
+ * @param dim 행렬 차원
+ * @return 성공 여부 (피벗이 양수가 아니면 실패)
+ */
+boolean_T Cholesky_Factor(real_T* A, uint32_T dim);
+
+/**
+ * @brief Cholesky 풀이: (L * L^T) x = b (제자리)
+ * @param L Cholesky_Factor 결과 (dim x dim)
+ * @param b 입력 우변 / 출력 해 (dim)
+ * @param dim 행렬 차원
+ */
+void Cholesky_Solve(const real_T* L, real_T* b, uint32_T dim);
+
+/**
+ * @brief Cholesky 다중 우변 풀이: (L * L^T) X = B (제자리)
+ * @param L Cholesky_Factor 결과 (dim x dim)
+ * @param B 입력 우변 / 출력 해 (dim x nrhs, row-major)
+ * @param dim 행렬 차원
+ * @param nrhs 우변 개수
+ */
+void Cholesky_SolveMatrix(const real_T* L, real_T* B, uint32_T dim, uint32_T nrhs);
+
+/**
+ * @brief 분해 결과로부터 전체 역행렬 계산: A_inv = (L * L^T)^(-1)
+ * 공분산 행렬 자체가 필요한 경우에만 사용 (풀이에는 Cholesky_Solve 사용)
+ * @param L Cholesky_Factor 결과 (dim x dim)
+ * @param A_inv 출력 역행렬 (dim x dim, 대칭)
+ * @param dim 행렬 차원
+ */
+void Cholesky_Inverse(const real_T* L, real_T* A_inv, uint32_T dim);
+
+/**
+ * @brief LDL^T 분해: A = L * D * L^T (제자리, 제곱근 없음)
+ * @param A 입력 SPD 행렬 / 출력 L(단위 대각 생략) 및 D(대각)
+ * @param dim 행렬 차원
+ * @return 성공 여부 (D의 원소가 양수가 아니면 실패)
+ */
+boolean_T LDLT_Factor(real_T* A, uint32_T dim);
+
+/**
+ * @brief LDL^T 풀이: (L * D * L^T) x = b (제자리)
+ * @param LD LDLT_Factor 결과 (dim x dim)
+ * @param b 입력 우변 / 출력 해 (dim)
+ * @param dim 행렬 차원
+ */
+void LDLT_Solve(const real_T* LD, real_T* b, uint32_T dim);
+
+/*
+ * 고정 크기 특수화 (n = 2 .. 8)
+ * 의미는 일반 차원 함수와 같고, 차원이 컴파일 타임 상수라 루프가 펼쳐짐
+ */
+boolean_T Cholesky_Factor2(real_T* A);
+boolean_T Cholesky_Factor3(real_T* A);
+boolean_T Cholesky_Factor4(real_T* A);
+boolean_T Cholesky_Factor5(real_T* A);
+boolean_T Cholesky_Factor6(real_T* A);
+boolean_T Cholesky_Factor7(real_T* A);
+boolean_T Cholesky_Factor8(real_T* A);
+
+void Cholesky_Solve2(const real_T* L, real_T* b);
+void Cholesky_Solve3(const real_T* L, real_T* b);
+void Cholesky_Solve4(const real_T* L, real_T* b);
+void Cholesky_Solve5(const real_T* L, real_T* b);
+void Cholesky_Solve6(const real_T* L, real_T* b);
+void Cholesky_Solve7(const real_T* L, real_T* b);
+void Cholesky_Solve8(const real_T* L, real_T* b);
+
+boolean_T LDLT_Factor2(real_T* A);
+boolean_T LDLT_Factor3(real_T* A);
+boolean_T LDLT_Factor4(real_T* A);
+boolean_T LDLT_Factor5(real_T* A);
+boolean_T LDLT_Factor6(real_T* A);
+boolean_T LDLT_Factor7(real_T* A);
+boolean_T LDLT_Factor8(real_T* A);
+
+void LDLT_Solve2(const real_T* LD, real_T* b);
+void LDLT_Solve3(const real_T* LD, real_T* b);
+void LDLT_Solve4(const real_T* LD, real_T* b);
+void LDLT_Solve5(const real_T* LD, real_T* b);
+void LDLT_Solve6(const real_T* LD, real_T* b);
+void LDLT_Solve7(const real_T* LD, real_T* b);
+void LDLT_Solve8(const real_T* LD, real_T* b);
+
+/*
+ * SoA 배치 (matrix_batch.h와 같은 배치)
+ * 시스템 b의 (i,j) 요소 = A[(i * dim + j) * count + b], 우변 i 요소 = x[i * count + b]
+ */
+
+/**
+ * @brief 배치 Cholesky 분해 (분기 없음)
+ * SPD가 아닌 시스템은 조기 반환 대신 피벗을 1로 대체하고 마스크로 표시
+ * @param A 입력 SPD 행렬 배치 / 출력 L 배치 (SoA, dim * dim * count)
+ * @param valid 출력 마스크 (count, 분해 성공 시 true, NULL 허용)
+ * @param dim 행렬 차원 (1 .. CHOLESKY_MAX_FIXED_DIM)
+ * @param count 시스템 개수
+ * @return 분해에 실패한 시스템 개수 (차원이 범위 밖이면 count)
+ */
+uint32_T Cholesky_FactorBatch(real_T* A, boolean_T* valid, uint32_T dim, uint32_T count);
+
+/**
+ * @brief 배치 Cholesky 풀이: (L * L^T) x = b (제자리)
+ * @param L Cholesky_FactorBatch 결과 (SoA, dim * dim * count)
+ * @param b 입력 우변 / 출력 해 (SoA, dim * count)
+ * @param dim 행렬 차원 (1 .. CHOLESKY_MAX_FIXED_DIM)
+ * @param count 시스템 개수
+ */
+void Cholesky_SolveBatch(const real_T* L, real_T* b, uint32_T dim, uint32_T count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHOLESKY_H */
@@ -0,0 +1,110 @@
+/*
+ * matrix_batch.h
+ *
+ * 배치 소형 행렬 연산 모듈
+ * 수천 개의 2x2, 3x3 행렬을 SoA (Structure of Arrays) 배치로 한 번에 처리
+ *
+ * 메모리 배치:
+ * - 요소 k (row-major 순서)의 열이 연속으로 저장됨
+ * - b번째 행렬의 k번째 요소 = A[k * count + b]
+ * - SIMD 레인 하나가 행렬 하나를 담당 (SSE2: 2개, AVX: 4개 동시)
+ *
+ * 주요 기능:
+ * - 배치 행렬 곱셈 / 전치 / 행렬식
+ * - 분기 없는 배치 역행렬 (행렬식 0 마스크 출력)
+ *
+ * 출력 버퍼는 입력 버퍼와 같아도 됨 (레인 블록 단위로 모두 읽은 뒤 저장)
+ */
+
+#ifndef MATRIX_BATCH_H
+#define MATRIX_BATCH_H
+
+#include "rtwtypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 함수 선언 */
+
+/* 2x2 배치 연산 */
+
+/**
+ * @brief 2x2 배치 행렬 곱셈: C[b] = A[b] * B[b]
+ * @param A 입력 행렬 배치 A (SoA, 4 * count)
+ * @param B 입력 행렬 배치 B (SoA, 4 * count)
+ * @param C 출력 행렬 배치 C (SoA, 4 * count)
+ * @param count 행렬 개수
+ */
+void Matrix2x2_MultiplyBatch(const real_T* A, const real_T* B, real_T* C, uint32_T count);
+
+/**
+ * @brief 2x2 배치 행렬 전치: B[b] = A[b]^T
+ * @param A 입력 행렬 배치 A (SoA, 4 * count)
+ * @param B 출력 행렬 배치 B (SoA, 4 * count)
+ * @param count 행렬 개수
+ */
+void Matrix2x2_TransposeBatch(const real_T* A, real_T* B, uint32_T count);
+
+/**
+ * @brief 2x2 배치 행렬식 계산
+ * @param A 입력 행렬 배치 A (SoA, 4 * count)
+ * @param det 출력 행렬식 배열 (count)
+ * @param count 행렬 개수
+ */
+void Matrix2x2_DeterminantBatch(const real_T* A, real_T* det, uint32_T count);
+
+/**
+ * @brief 2x2 배치 역행렬 (분기 없음): B[b] = A[b]^(-1)
+ * 행렬식이 0에 가까운 행렬은 조기 반환 대신 출력을 0으로 채우고 마스크로 표시
+ * @param A 입력 행렬 배치 A (SoA, 4 * count)
+ * @param B 출력 행렬 배치 B (SoA, 4 * count)
+ * @param valid 출력 마스크 (count, 역행렬 존재 시 true, NULL 허용)
+ * @param count 행렬 개수
+ * @return 역행렬이 존재하지 않는 행렬 개수
+ */
+uint32_T Matrix2x2_InverseBatch(const real_T* A, real_T* B, boolean_T* valid, uint32_T count);
+
+/* 3x3 배치 연산 */
+
+/**
+ * @brief 3x3 배치 행렬 곱셈: C[b] = A[b] * B[b]
+ * @param A 입력 행렬 배치 A (SoA, 9 * count)
+ * @param B 입력 행렬 배치 B (SoA, 9 * count)
+ * @param C 출력 행렬 배치 C (SoA, 9 * count)
+ * @param count 행렬 개수
+ */
+void Matrix3x3_MultiplyBatch(const real_T* A, const real_T* B, real_T* C, uint32_T count);
+
+/**
+ * @brief 3x3 배치 행렬 전치: B[b] = A[b]^T
+ * @param A 입력 행렬 배치 A (SoA, 9 * count)
+ * @param B 출력 행렬 배치 B (SoA, 9 * count)
+ * @param count 행렬 개수
+ */
+void Matrix3x3_TransposeBatch(const real_T* A, real_T* B, uint32_T count);
+
+/**
+ * @brief 3x3 배치 행렬식 계산
+ * @param A 입력 행렬 배치 A (SoA, 9 * count)
+ * @param det 출력 행렬식 배열 (count)
+ * @param count 행렬 개수
+ */
+void Matrix3x3_DeterminantBatch(const real_T* A, real_T* det, uint32_T count);
+
+/**
+ * @brief 3x3 배치 역행렬 (분기 없음): B[b] = A[b]^(-1)
+ * 행렬식이 0에 가까운 행렬은 조기 반환 대신 출력을 0으로 채우고 마스크로 표시
+ * @param A 입력 행렬 배치 A (SoA, 9 * count)
+ * @param B 출력 행렬 배치 B (SoA, 9 * count)
+ * @param valid 출력 마스크 (count, 역행렬 존재 시 true, NULL 허용)
+ * @param count 행렬 개수
+ * @return 역행렬이 존재하지 않는 행렬 개수
+ */
+uint32_T Matrix3x3_InverseBatch(const real_T* A, real_T* B, boolean_T* valid, uint32_T count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MATRIX_BATCH_H */
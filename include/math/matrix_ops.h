@@ -10,6 +10,11 @@
  * - 행렬 덧셈/뺄셈 (Matrix Addition/Subtraction)
  * - 행렬 역행렬 (Matrix Inverse)
  * - 행렬식 계산 (Determinant)
+ * - 융합 공분산 연산 (F*P*F^T + Q, (I - K*H)*P)
+ * - 대칭 랭크-1 업데이트 (전체 저장 / 상삼각 압축 저장)
+ *
+ * 2x2, 3x3 연산은 small_matrix.hpp 템플릿 기반 구현(matrix_ops_fixed.cpp)이며
+ * 이 헤더의 C 시그니처는 그대로 유지됨
  */
 
 #ifndef MATRIX_OPS_H
@@ -85,6 +90,26 @@ real_T Matrix2x2_Determinant(const real_T* A);
  */
 void Matrix2x2_ScalarMultiply(const real_T* A, real_T k, real_T* B);
 
+/**
+ * @brief 2x2 공분산 예측 (융합 연산): P_out = F * P * F^T + Q
+ * @param F 상태 전이 행렬 (2x2)
+ * @param P 공분산 행렬 (2x2)
+ * @param Q 프로세스 노이즈 공분산 행렬 (2x2)
+ * @param P_out 출력 공분산 행렬 (2x2, P와 같은 버퍼 허용)
+ */
+void Matrix2x2_CovariancePredict(const real_T* F, const real_T* P,
+                                 const real_T* Q, real_T* P_out);
+
+/**
+ * @brief 2x2 공분산 측정 업데이트 (융합 연산): P_out = (I - K * H) * P
+ * @param K 칼만 게인 (2x1)
+ * @param H 측정 행렬 (1x2)
+ * @param P 공분산 행렬 (2x2)
+ * @param P_out 출력 공분산 행렬 (2x2, P와 같은 버퍼 허용)
+ */
+void Matrix2x2_CovarianceUpdate(const real_T* K, const real_T* H,
+                                const real_T* P, real_T* P_out);
+
 /* 3x3 행렬 연산 */
 
 /**
@@ -141,6 +166,26 @@ real_T Matrix3x3_Determinant(const real_T* A);
  */
 void Matrix3x3_ScalarMultiply(const real_T* A, real_T k, real_T* B);
 
+/**
+ * @brief 3x3 공분산 예측 (융합 연산): P_out = F * P * F^T + Q
+ * @param F 상태 전이 행렬 (3x3)
+ * @param P 공분산 행렬 (3x3)
+ * @param Q 프로세스 노이즈 공분산 행렬 (3x3)
+ * @param P_out 출력 공분산 행렬 (3x3, P와 같은 버퍼 허용)
+ */
+void Matrix3x3_CovariancePredict(const real_T* F, const real_T* P,
+                                 const real_T* Q, real_T* P_out);
+
+/**
+ * @brief 3x3 공분산 측정 업데이트 (융합 연산): P_out = (I - K * H) * P
+ * @param K 칼만 게인 (3x1)
+ * @param H 측정 행렬 (1x3)
+ * @param P 공분산 행렬 (3x3)
+ * @param P_out 출력 공분산 행렬 (3x3, P와 같은 버퍼 허용)
+ */
+void Matrix3x3_CovarianceUpdate(const real_T* K, const real_T* H,
+                                const real_T* P, real_T* P_out);
+
 /* 일반 행렬 연산 */
 
 /**
@@ -173,6 +218,46 @@ void Matrix_Copy(const real_T* A, real_T* B, uint32_T dim);
  */
 void Matrix_Print(const real_T* A, uint32_T dim, const char* name);
 
+/* 대칭 랭크-1 업데이트 */
+
+/**
+ * @brief 대칭 랭크-1 업데이트: P = scale * (P + alpha * w * w^T)
+ * 상삼각만 계산한 뒤 하삼각에 복사하여 결과가 정확히 대칭을 유지
+ * RLS 공분산 갱신 P = (P - (P*phi)(P*phi)^T / S) / lambda 를 O(n^2)로 처리
+ * @param P 대칭 행렬 (dim x dim, 전체 저장, 제자리 갱신)
+ * @param w 벡터 (dim)
+ * @param alpha 랭크-1 항 계수
+ * @param scale 전체 배율
+ * @param dim 행렬 차원
+ */
+void Matrix_SymRank1Update(real_T* P, const real_T* w, real_T alpha, real_T scale, uint32_T dim);
+
+/**
+ * @brief 대칭 압축 배치의 랭크-1 업데이트: Pp = scale * (Pp + alpha * w * w^T)
+ * @param Pp 대칭 행렬의 상삼각 압축 배열 (dim * (dim + 1) / 2, 행 우선)
+ * @param w 벡터 (dim)
+ * @param alpha 랭크-1 항 계수
+ * @param scale 전체 배율
+ * @param dim 행렬 차원
+ */
+void Matrix_SymRank1UpdatePacked(real_T* Pp, const real_T* w, real_T alpha, real_T scale, uint32_T dim);
+
+/**
+ * @brief 대칭 행렬을 상삼각 압축 배열로 변환
+ * @param A 입력 대칭 행렬 (dim x dim)
+ * @param Ap 출력 압축 배열 (dim * (dim + 1) / 2)
+ * @param dim 행렬 차원
+ */
+void Matrix_SymPack(const real_T* A, real_T* Ap, uint32_T dim);
+
+/**
+ * @brief 상삼각 압축 배열을 대칭 행렬로 복원
+ * @param Ap 입력 압축 배열 (dim * (dim + 1) / 2)
+ * @param A 출력 대칭 행렬 (dim x dim)
+ * @param dim 행렬 차원
+ */
+void Matrix_SymUnpack(const real_T* Ap, real_T* A, uint32_T dim);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,85 @@
+/*
+ * matrix_padded.h
+ *
+ * 패딩된 3x3 행렬 모듈
+ * 3x3 행렬의 각 행을 0 레인 하나를 더한 4개 double로 저장 (3x4)
+ * 한 행이 256비트 레지스터 하나에 정확히 들어가므로 AVX로 행 단위 연산 가능
+ *
+ * 주요 기능:
+ * - 압축(9요소) <-> 패딩(12요소) 변환 (SoCesti_DW.Delay_DSTATE_o 등과 연결)
+ * - 행렬 곱셈 / 덧셈
+ * - 랭크-1 업데이트 (RLS 3x3 공분산 갱신용)
+ *
+ * AVX를 지원하지 않는 빌드에서는 같은 배치를 일반 연산으로 처리
+ */
+
+#ifndef MATRIX_PADDED_H
+#define MATRIX_PADDED_H
+
+#include "rtwtypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 패딩 행렬 크기 상수 */
+#define MATRIX_3X4_STRIDE   4       /* 패딩된 행의 폭 */
+#define MATRIX_3X4_SIZE     12      /* 패딩된 3x3 행렬의 요소 개수 */
+
+/* 패딩된 3x3 행렬 (row-major, 각 행의 4번째 요소는 항상 0)
+ * 정렬은 real_T와 같음 (32바이트 정렬을 요구하지 않으므로 malloc / 구조체 멤버 배치 모두 가능) */
+typedef struct {
+    real_T m[MATRIX_3X4_SIZE];
+} Matrix3x3_Padded_T;
+
+/* 함수 선언 */
+
+/**
+ * @brief 압축 3x3 행렬을 패딩 배치로 변환
+ * @param A 입력 행렬 (9요소, row-major)
+ * @param P 출력 패딩 행렬
+ */
+void Matrix3x3_ToPadded(const real_T* A, Matrix3x3_Padded_T* P);
+
+/**
+ * @brief 패딩 행렬을 압축 3x3 행렬로 변환
+ * @param P 입력 패딩 행렬
+ * @param A 출력 행렬 (9요소, row-major)
+ */
+void Matrix3x3_FromPadded(const Matrix3x3_Padded_T* P, real_T* A);
+
+/**
+ * @brief 패딩 행렬 곱셈: C = A * B
+ * @param A 입력 행렬 A
+ * @param B 입력 행렬 B
+ * @param C 출력 행렬 C (A 또는 B와 같아도 됨)
+ */
+void Matrix3x3_MultiplyPadded(const Matrix3x3_Padded_T* A, const Matrix3x3_Padded_T* B,
+                              Matrix3x3_Padded_T* C);
+
+/**
+ * @brief 패딩 행렬 덧셈: C = A + B
+ * @param A 입력 행렬 A
+ * @param B 입력 행렬 B
+ * @param C 출력 행렬 C (A 또는 B와 같아도 됨)
+ */
+void Matrix3x3_AddPadded(const Matrix3x3_Padded_T* A, const Matrix3x3_Padded_T* B,
+                         Matrix3x3_Padded_T* C);
+
+/**
+ * @brief 패딩 행렬 랭크-1 업데이트: C = A + alpha * u * v^T
+ * @param A 입력 행렬 A
+ * @param alpha 스칼라 계수
+ * @param u 열 벡터 (3요소)
+ * @param v 행 벡터 (3요소)
+ * @param C 출력 행렬 C (A와 같아도 됨)
+ */
+void Matrix3x3_Rank1UpdatePadded(const Matrix3x3_Padded_T* A, real_T alpha,
+                                 const real_T* u, const real_T* v,
+                                 Matrix3x3_Padded_T* C);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MATRIX_PADDED_H */
@@ -15,6 +15,7 @@
 #define SIMD_OPS_H
 
 #include "rtwtypes.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -152,6 +153,15 @@ real_T SIMD_VectorDotProduct4(const real_T* A, const real_T* B);
  */
 real_T SIMD_VectorDotProduct8(const real_T* A, const real_T* B);
 
+/**
+ * @brief SIMD 벡터 합 (임의 길이)
+ * 독립 누산기 여러 개로 덧셈 의존 사슬을 끊어 긴 배열도 처리량 한계로 합산
+ * @param A 입력 벡터 A
+ * @param n 요소 개수
+ * @return 요소 합
+ */
+real_T SIMD_VectorSum(const real_T* A, size_t n);
+
 /**
  * @brief SIMD 벡터 최대값 찾기 (2개 double)
  * @param A 입력 벡터 A
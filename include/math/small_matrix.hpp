@@ -0,0 +1,309 @@
+/*
+ * small_matrix.hpp
+ *
+ * 고정 크기 소형 행렬 템플릿 모듈 (C++ 헤더 전용)
+ * 컴파일 타임 차원을 갖는 Mat<R,C,T>와 표현식 템플릿을 제공
+ *
+ * 주요 기능:
+ * - 컴파일 타임 차원 검사 (차원이 맞지 않는 연산은 컴파일 오류)
+ * - 표현식 템플릿 (Expression Template): F*P*F^T + Q, (I-K*H)*P 같은
+ *   연쇄 연산을 중간 배열 없이 한 번의 레지스터 상주 패스로 평가
+ * - FMA (Fused Multiply-Add) 누적
+ * - 기존 row-major real_T 배열과의 연결 (Map, Store)
+ *
+ * C 코드에서는 matrix_ops.h의 Matrix2x2_* / Matrix3x3_* 함수를 통해 사용
+ */
+
+#ifndef SMALL_MATRIX_HPP
+#define SMALL_MATRIX_HPP
+
+#include "rtwtypes.h"
+#include <cmath>
+
+namespace soc {
+
+/**
+ * @brief 곱셈-누적: a * b + c
+ * 하드웨어 FMA가 있을 때만 std::fma 사용 (소프트웨어 에뮬레이션 회피)
+ */
+template <typename T>
+inline T Madd(T a, T b, T c)
+{
+#if defined(FP_FAST_FMA) || defined(__FMA__)
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+/* 모든 행렬 표현식의 기반 (CRTP) */
+template <typename E, int R, int C, typename T>
+struct MatExpr {
+    typedef T Scalar;
+    enum { kRows = R, kCols = C };
+
+    const E& Self() const { return static_cast<const E&>(*this); }
+    T operator()(int i, int j) const { return Self().At(i, j); }
+};
+
+/* 실제 저장소를 갖는 행렬 (row-major) */
+template <int R, int C, typename T = real_T>
+struct Mat : MatExpr<Mat<R, C, T>, R, C, T> {
+    T a[R * C];
+
+    Mat() {}
+
+    /* 표현식으로부터 생성: 새 객체이므로 별칭(alias) 문제 없이 바로 평가 */
+    template <typename E>
+    Mat(const MatExpr<E, R, C, T>& e)
+    {
+        for (int i = 0; i < R; i++) {
+            for (int j = 0; j < C; j++) {
+                a[i * C + j] = e.Self().At(i, j);
+            }
+        }
+    }
+
+    /* 표현식 대입: 우변이 자기 자신을 참조할 수 있으므로 임시 행렬에 먼저 평가 */
+    template <typename E>
+    Mat& operator=(const MatExpr<E, R, C, T>& e)
+    {
+        Mat tmp(e);
+        for (int i = 0; i < R * C; i++) {
+            a[i] = tmp.a[i];
+        }
+        return *this;
+    }
+
+    T At(int i, int j) const { return a[i * C + j]; }
+    T& operator()(int i, int j) { return a[i * C + j]; }
+    T operator()(int i, int j) const { return a[i * C + j]; }
+
+    static Mat Load(const T* src)
+    {
+        Mat m;
+        for (int i = 0; i < R * C; i++) {
+            m.a[i] = src[i];
+        }
+        return m;
+    }
+};
+
+/* 기존 real_T 배열을 복사 없이 행렬로 보는 읽기 전용 뷰 */
+template <int R, int C, typename T = real_T>
+struct Map : MatExpr<Map<R, C, T>, R, C, T> {
+    const T* p;
+
+    explicit Map(const T* ptr) : p(ptr) {}
+    T At(int i, int j) const { return p[i * C + j]; }
+};
+
+/* 단위 행렬 표현식 (저장소 없음) */
+template <int N, typename T = real_T>
+struct Identity : MatExpr<Identity<N, T>, N, N, T> {
+    T At(int i, int j) const { return (i == j) ? T(1) : T(0); }
+};
+
+/*
+ * 곱셈 피연산자 보관 방식
+ * - Mat: 참조 (이미 메모리에 있음)
+ * - Map / Identity / 전치 뷰: 값 (지연 평가, 재계산 비용 없음)
+ * - 그 외 표현식: 한 번만 평가한 Mat 값 (곱셈에서 원소가 여러 번 읽히므로
+ *   재계산을 막고, 크기가 작아 레지스터에 상주)
+ */
+template <typename E>
+struct Nested {
+    typedef Mat<E::kRows, E::kCols, typename E::Scalar> Type;
+};
+
+template <int R, int C, typename T>
+struct Nested<Mat<R, C, T> > {
+    typedef const Mat<R, C, T>& Type;
+};
+
+template <int R, int C, typename T>
+struct Nested<Map<R, C, T> > {
+    typedef Map<R, C, T> Type;
+};
+
+template <int N, typename T>
+struct Nested<Identity<N, T> > {
+    typedef Identity<N, T> Type;
+};
+
+/* 원소 단위 연산 피연산자 보관 방식: Mat은 참조, 나머지는 값 (원소당 한 번만 읽힘) */
+template <typename E>
+struct Lazy {
+    typedef E Type;
+};
+
+template <int R, int C, typename T>
+struct Lazy<Mat<R, C, T> > {
+    typedef const Mat<R, C, T>& Type;
+};
+
+/* 전치: B = A^T */
+template <typename E, int R, int C, typename T>
+struct Transposed : MatExpr<Transposed<E, R, C, T>, C, R, T> {
+    typename Nested<E>::Type e;
+
+    explicit Transposed(const E& x) : e(x) {}
+    T At(int i, int j) const { return e.At(j, i); }
+};
+
+template <typename E, int R, int C, typename T>
+struct Nested<Transposed<E, R, C, T> > {
+    typedef Transposed<E, R, C, T> Type;
+};
+
+/* 덧셈: A + B */
+template <typename L, typename Rt, int R, int C, typename T>
+struct Sum : MatExpr<Sum<L, Rt, R, C, T>, R, C, T> {
+    typename Lazy<L>::Type l;
+    typename Lazy<Rt>::Type r;
+
+    Sum(const L& x, const Rt& y) : l(x), r(y) {}
+    T At(int i, int j) const { return l.At(i, j) + r.At(i, j); }
+};
+
+/* 뺄셈: A - B */
+template <typename L, typename Rt, int R, int C, typename T>
+struct Difference : MatExpr<Difference<L, Rt, R, C, T>, R, C, T> {
+    typename Lazy<L>::Type l;
+    typename Lazy<Rt>::Type r;
+
+    Difference(const L& x, const Rt& y) : l(x), r(y) {}
+    T At(int i, int j) const { return l.At(i, j) - r.At(i, j); }
+};
+
+/* 스칼라 곱: k * A */
+template <typename E, int R, int C, typename T>
+struct Scaled : MatExpr<Scaled<E, R, C, T>, R, C, T> {
+    typename Lazy<E>::Type e;
+    T k;
+
+    Scaled(const E& x, T s) : e(x), k(s) {}
+    T At(int i, int j) const { return e.At(i, j) * k; }
+};
+
+/* 행렬 곱: A (RxK) * B (KxC), FMA 누적 */
+template <typename L, typename Rt, int R, int K, int C, typename T>
+struct Product : MatExpr<Product<L, Rt, R, K, C, T>, R, C, T> {
+    typename Nested<L>::Type l;
+    typename Nested<Rt>::Type r;
+
+    Product(const L& x, const Rt& y) : l(x), r(y) {}
+
+    T At(int i, int j) const
+    {
+        T acc = l.At(i, 0) * r.At(0, j);
+        for (int k = 1; k < K; k++) {
+            acc = Madd(l.At(i, k), r.At(k, j), acc);
+        }
+        return acc;
+    }
+};
+
+/* 연산자 - 차원이 맞지 않으면 후보가 없어 컴파일 오류 */
+
+template <typename L, typename Rt, int R, int C, typename T>
+inline Sum<L, Rt, R, C, T> operator+(const MatExpr<L, R, C, T>& x, const MatExpr<Rt, R, C, T>& y)
+{
+    return Sum<L, Rt, R, C, T>(x.Self(), y.Self());
+}
+
+template <typename L, typename Rt, int R, int C, typename T>
+inline Difference<L, Rt, R, C, T> operator-(const MatExpr<L, R, C, T>& x, const MatExpr<Rt, R, C, T>& y)
+{
+    return Difference<L, Rt, R, C, T>(x.Self(), y.Self());
+}
+
+template <typename L, typename Rt, int R, int K, int C, typename T>
+inline Product<L, Rt, R, K, C, T> operator*(const MatExpr<L, R, K, T>& x, const MatExpr<Rt, K, C, T>& y)
+{
+    return Product<L, Rt, R, K, C, T>(x.Self(), y.Self());
+}
+
+template <typename E, int R, int C, typename T>
+inline Scaled<E, R, C, T> operator*(const MatExpr<E, R, C, T>& x, typename MatExpr<E, R, C, T>::Scalar k)
+{
+    return Scaled<E, R, C, T>(x.Self(), k);
+}
+
+template <typename E, int R, int C, typename T>
+inline Scaled<E, R, C, T> operator*(typename MatExpr<E, R, C, T>::Scalar k, const MatExpr<E, R, C, T>& x)
+{
+    return Scaled<E, R, C, T>(x.Self(), k);
+}
+
+template <typename E, int R, int C, typename T>
+inline Transposed<E, R, C, T> Transpose(const MatExpr<E, R, C, T>& x)
+{
+    return Transposed<E, R, C, T>(x.Self());
+}
+
+/**
+ * @brief 표현식을 평가하여 row-major 배열에 저장
+ * 출력 버퍼가 입력과 겹쳐도 안전하도록 레지스터 상주 임시 행렬에 먼저 평가
+ */
+template <typename E, int R, int C, typename T>
+inline void Store(T* dst, const MatExpr<E, R, C, T>& x)
+{
+    Mat<R, C, T> tmp(x);
+    for (int i = 0; i < R * C; i++) {
+        dst[i] = tmp.a[i];
+    }
+}
+
+/* 행렬식 */
+
+template <typename E, typename T>
+inline T Determinant(const MatExpr<E, 2, 2, T>& x)
+{
+    const E& m = x.Self();
+    return m.At(0, 0) * m.At(1, 1) - m.At(0, 1) * m.At(1, 0);
+}
+
+template <typename E, typename T>
+inline T Determinant(const MatExpr<E, 3, 3, T>& x)
+{
+    const E& m = x.Self();
+    return m.At(0, 0) * (m.At(1, 1) * m.At(2, 2) - m.At(1, 2) * m.At(2, 1))
+         - m.At(0, 1) * (m.At(1, 0) * m.At(2, 2) - m.At(1, 2) * m.At(2, 0))
+         + m.At(0, 2) * (m.At(1, 0) * m.At(2, 1) - m.At(1, 1) * m.At(2, 0));
+}
+
+/* 수반 행렬 (Adjugate): A^(-1) = adj(A) / det(A) */
+
+template <typename E, typename T>
+inline Mat<2, 2, T> Adjugate(const MatExpr<E, 2, 2, T>& x)
+{
+    const E& m = x.Self();
+    Mat<2, 2, T> b;
+    b.a[0] = m.At(1, 1);
+    b.a[1] = -m.At(0, 1);
+    b.a[2] = -m.At(1, 0);
+    b.a[3] = m.At(0, 0);
+    return b;
+}
+
+template <typename E, typename T>
+inline Mat<3, 3, T> Adjugate(const MatExpr<E, 3, 3, T>& x)
+{
+    const E& m = x.Self();
+    Mat<3, 3, T> b;
+    b.a[0] = m.At(1, 1) * m.At(2, 2) - m.At(1, 2) * m.At(2, 1);
+    b.a[1] = m.At(0, 2) * m.At(2, 1) - m.At(0, 1) * m.At(2, 2);
+    b.a[2] = m.At(0, 1) * m.At(1, 2) - m.At(0, 2) * m.At(1, 1);
+    b.a[3] = m.At(1, 2) * m.At(2, 0) - m.At(1, 0) * m.At(2, 2);
+    b.a[4] = m.At(0, 0) * m.At(2, 2) - m.At(0, 2) * m.At(2, 0);
+    b.a[5] = m.At(0, 2) * m.At(1, 0) - m.At(0, 0) * m.At(1, 2);
+    b.a[6] = m.At(1, 0) * m.At(2, 1) - m.At(1, 1) * m.At(2, 0);
+    b.a[7] = m.At(0, 1) * m.At(2, 0) - m.At(0, 0) * m.At(2, 1);
+    b.a[8] = m.At(0, 0) * m.At(1, 1) - m.At(0, 1) * m.At(1, 0);
+    return b;
+}
+
+} /* namespace soc */
+
+#endif /* SMALL_MATRIX_HPP */
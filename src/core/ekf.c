@@ -6,6 +6,10 @@
  */
 
 #include "ekf.h"
+#include "ekf_gain_table.h"
+#include "matrix_ops.h"
+#include "simd_ops.h"
+#include <stdio.h>
 #include <string.h>
 #include <math.h>
 
@@ -16,11 +20,33 @@
 #define EKF_MAX_SOC        1.0     /* 최대 SoC */
 #define EKF_MIN_VOLTAGE_ERROR -1.0 /* 최소 전압 오차 */
 #define EKF_MAX_VOLTAGE_ERROR  1.0 /* 최대 전압 오차 */
+#define EKF_GAIN_FLOOR     1e-12   /* 게인 수렴 판정 시 최소 기준 크기 */
+#define EKF_NIS_EXPECTED   1.0     /* 정상 동작 시 NIS 기대값 (측정 1차원) */
 
 /* 전역 변수 - 기존 코드와의 호환성을 위해 */
 extern real_T look1_binlxpw(real_T u0, const real_T bp0[], const real_T table[],
                            uint32_T maxIndex);
 
+/**
+ * @brief 전류 영역 분류 (-1: 충전, 0: 휴지, 1: 방전)
+ */
+static int32_T EKF_CurrentRegime(const EKF_T* ekf, real_T current)
+{
+    if (fabs(current) <= ekf->steady.rest_current) {
+        return 0;
+    }
+    return (current > 0.0) ? 1 : -1;
+}
+
+/**
+ * @brief 고정 게인 해제 후 수렴 판정을 처음부터 다시 시작
+ */
+static void EKF_ReleaseGain(EKF_T* ekf)
+{
+    ekf->internal.gain_frozen = false;
+    ekf->internal.converged_steps = 0;
+}
+
 /**
  * @brief EKF 초기화
  */
@@ -50,8 +76,7 @@ boolean_T EKF_Initialize(EKF_T* ekf, const EKF_Params_T* params)
     ekf->internal.F[3] = 1.0;  /* F22 */
     
     /* 측정 행렬 초기화 */
-    ekf->internal.H[0] = 1.0;  /* H1 */
-    ekf->internal.H[1] = 0.0;  /* H2 */
+    EKF_GetMeasurementJacobian(ekf->state.soc, ekf->internal.H);
     
     /* 칼만 게인 초기화 */
     ekf->internal.K[0] = 0.0;
@@ -61,12 +86,74 @@ boolean_T EKF_Initialize(EKF_T* ekf, const EKF_Params_T* params)
     ekf->internal.innovation = 0.0;
     ekf->internal.innovation_covariance = 1.0;
     
+    /* 정상 상태 게인 모드는 EKF_SetSteadyState 호출 전까지 비활성 */
+    memset(&ekf->steady, 0, sizeof(EKF_SteadyState_T));
+    ekf->internal.gain_frozen = false;
+    ekf->internal.converged_steps = 0;
+    ekf->internal.last_dt = params->dt;
+    ekf->internal.current_regime = 0;
+    ekf->internal.nis_average = EKF_NIS_EXPECTED;
+    ekf->gain_table = NULL;
+    
     /* 초기화 완료 플래그 설정 */
     ekf->initialized = true;
     
     return true;
 }
 
+/**
+ * @brief 정상 상태 고정 게인 모드 설정
+ */
+void EKF_SetSteadyState(EKF_T* ekf, const EKF_SteadyState_T* config)
+{
+    if (ekf == NULL || config == NULL) {
+        return;
+    }
+    
+    memcpy(&ekf->steady, config, sizeof(EKF_SteadyState_T));
+    EKF_ReleaseGain(ekf);
+    ekf->internal.nis_average = EKF_NIS_EXPECTED;
+}
+
+/**
+ * @brief 게인 고정 여부 반환
+ */
+boolean_T EKF_IsGainFrozen(const EKF_T* ekf)
+{
+    if (ekf == NULL || !ekf->initialized) {
+        return false;
+    }
+    return ekf->internal.gain_frozen;
+}
+
+/**
+ * @brief 게인 스케줄링 모드 설정
+ */
+void EKF_SetGainSchedule(EKF_T* ekf, const struct EKF_GainTable_T* table)
+{
+    if (ekf == NULL) {
+        return;
+    }
+    
+    ekf->gain_table = (table != NULL && table->initialized) ? table : NULL;
+    EKF_ReleaseGain(ekf);
+}
+
+/**
+ * @brief 측정 야코비안 H (1x2)
+ */
+void EKF_GetMeasurementJacobian(real_T soc, real_T* H)
+{
+    (void)soc;
+    
+    if (H == NULL) {
+        return;
+    }
+    
+    H[0] = 1.0;  /* H1 */
+    H[1] = 0.0;  /* H2 */
+}
+
 /**
  * @brief EKF 상태 예측 단계
  */
@@ -76,6 +163,18 @@ void EKF_Predict(EKF_T* ekf, real_T current, real_T dt)
         return;
     }
     
+    /* 정상 상태 모드: dt 또는 전류 영역이 바뀌면 수렴 판정을 다시 시작 */
+    if (ekf->steady.enable) {
+        int32_T regime = EKF_CurrentRegime(ekf, current);
+        
+        if (fabs(dt - ekf->internal.last_dt) > ekf->steady.dt_tolerance * fabs(ekf->internal.last_dt) ||
+            regime != ekf->internal.current_regime) {
+            EKF_ReleaseGain(ekf);
+        }
+        ekf->internal.last_dt = dt;
+        ekf->internal.current_regime = regime;
+    }
+    
     /* 상태 전이 행렬 업데이트 */
     real_T capacity_factor = dt / (ekf->params.capacity * 3600.0); /* 시간을 시간 단위로 변환 */
     
@@ -97,30 +196,94 @@ void EKF_Predict(EKF_T* ekf, real_T current, real_T dt)
     ekf->state.soc = soc_pred;
     ekf->state.voltage_error = voltage_error_pred;
     
-    /* 공분산 예측: P = F * P * F^T + Q */
-    real_T F_P[4];
-    real_T P_pred[4];
-    
-    /* F * P 계산 */
-    F_P[0] = ekf->internal.F[0] * ekf->internal.P[0] + ekf->internal.F[1] * ekf->internal.P[2];
-    F_P[1] = ekf->internal.F[0] * ekf->internal.P[1] + ekf->internal.F[1] * ekf->internal.P[3];
-    F_P[2] = ekf->internal.F[2] * ekf->internal.P[0] + ekf->internal.F[3] * ekf->internal.P[2];
-    F_P[3] = ekf->internal.F[2] * ekf->internal.P[1] + ekf->internal.F[3] * ekf->internal.P[3];
-    
-    /* (F * P) * F^T 계산 */
-    P_pred[0] = F_P[0] * ekf->internal.F[0] + F_P[1] * ekf->internal.F[1];
-    P_pred[1] = F_P[0] * ekf->internal.F[2] + F_P[1] * ekf->internal.F[3];
-    P_pred[2] = F_P[2] * ekf->internal.F[0] + F_P[3] * ekf->internal.F[1];
-    P_pred[3] = F_P[2] * ekf->internal.F[2] + F_P[3] * ekf->internal.F[3];
-    
-    /* 프로세스 노이즈 추가 */
-    P_pred[0] += ekf->params.Q[0];
-    P_pred[1] += ekf->params.Q[1];
-    P_pred[2] += ekf->params.Q[2];
-    P_pred[3] += ekf->params.Q[3];
-    
-    /* 공분산 업데이트 */
-    memcpy(ekf->internal.P, P_pred, sizeof(P_pred));
+    /* 게인 고정 / 스케줄링 중에는 공분산 전파 생략 (P는 마지막 사후 공분산 유지) */
+    if (ekf->internal.gain_frozen || ekf->gain_table != NULL) {
+        return;
+    }
+    
+    /* 공분산 예측: P = F * P * F^T + Q (융합 연산, 제자리 갱신) */
+    Matrix2x2_CovariancePredict(ekf->internal.F, ekf->internal.P,
+                                ekf->params.Q, ekf->internal.P);
+}
+
+/**
+ * @brief EKF 다중 스텝 예측 (측정 없이 전류 샘플 n개 누적)
+ */
+void EKF_PredictMulti(EKF_T* ekf, const real_T* current, size_t n, real_T dt)
+{
+    if (ekf == NULL || current == NULL || !ekf->initialized || n == 0) {
+        return;
+    }
+    
+    if (n == 1) {
+        EKF_Predict(ekf, current[0], dt);
+        return;
+    }
+    
+    /* 전하량 적분: 전류 합 (SIMD 리덕션) */
+    EKF_PredictSum(ekf, SIMD_VectorSum(current, n), n, dt);
+}
+
+/**
+ * @brief EKF 다중 스텝 예측 (누적 전류 합 사용)
+ */
+void EKF_PredictSum(EKF_T* ekf, real_T current_sum, size_t n, real_T dt)
+{
+    if (ekf == NULL || !ekf->initialized || n == 0) {
+        return;
+    }
+    
+    real_T steps = (real_T)n;
+    
+    /* 정상 상태 모드 판정은 구간 평균 전류 기준 */
+    if (ekf->steady.enable) {
+        int32_T regime = EKF_CurrentRegime(ekf, current_sum / steps);
+        
+        if (fabs(dt - ekf->internal.last_dt) > ekf->steady.dt_tolerance * fabs(ekf->internal.last_dt) ||
+            regime != ekf->internal.current_regime) {
+            EKF_ReleaseGain(ekf);
+        }
+        ekf->internal.last_dt = dt;
+        ekf->internal.current_regime = regime;
+    }
+    
+    /* 한 스텝 상태 전이 행렬 (EKF_Predict와 동일) */
+    real_T c = -dt / (ekf->params.capacity * 3600.0);
+    ekf->internal.F[1] = c;
+    
+    /* 상태 예측 */
+    real_T soc_pred = ekf->state.soc + c * current_sum;
+    
+    /* SoC 범위 제한 */
+    if (soc_pred > EKF_MAX_SOC) {
+        soc_pred = EKF_MAX_SOC;
+    } else if (soc_pred < EKF_MIN_SOC) {
+        soc_pred = EKF_MIN_SOC;
+    }
+    
+    ekf->state.soc = soc_pred;
+    
+    if (ekf->internal.gain_frozen || ekf->gain_table != NULL) {
+        return;
+    }
+    
+    /*
+     * F = [1 c; 0 1] 이므로 F^k = [1 k*c; 0 1].
+     * sum_{k=0}^{n-1} F^k Q F^kT 의 각 요소는 k, k^2의 합으로 정리됨
+     */
+    const real_T* Q = ekf->params.Q;
+    real_T s1 = steps * (steps - 1.0) * 0.5;                       /* sum k */
+    real_T s2 = (steps - 1.0) * steps * (2.0 * steps - 1.0) / 6.0; /* sum k^2 */
+    
+    real_T F_n[4] = { 1.0, steps * c, 0.0, 1.0 };
+    real_T Q_sum[4];
+    Q_sum[0] = steps * Q[0] + c * s1 * (Q[1] + Q[2]) + c * c * s2 * Q[3];
+    Q_sum[1] = steps * Q[1] + c * s1 * Q[3];
+    Q_sum[2] = steps * Q[2] + c * s1 * Q[3];
+    Q_sum[3] = steps * Q[3];
+    
+    /* 공분산 예측: P = F^n * P * (F^n)^T + Q_sum (융합 연산, 제자리 갱신) */
+    Matrix2x2_CovariancePredict(F_n, ekf->internal.P, Q_sum, ekf->internal.P);
 }
 
 /**
@@ -138,19 +301,50 @@ void EKF_Update(EKF_T* ekf, real_T voltage_measured, real_T current_measured)
     /* 혁신 계산 (Innovation) */
     ekf->internal.innovation = voltage_measured - voltage_predicted;
     
-    /* 혁신 공분산 계산: S = H * P * H^T + R */
-    real_T H_P[2];
-    H_P[0] = ekf->internal.H[0] * ekf->internal.P[0] + ekf->internal.H[1] * ekf->internal.P[1];
-    H_P[1] = ekf->internal.H[0] * ekf->internal.P[2] + ekf->internal.H[1] * ekf->internal.P[3];
-    
-    ekf->internal.innovation_covariance = H_P[0] * ekf->internal.H[0] + H_P[1] * ekf->internal.H[1] + ekf->params.R;
+    if (ekf->gain_table != NULL) {
+        /* 게인 스케줄링 모드: 현재 SoC로 테이블에서 게인 보간 */
+        EKF_GainTable_Lookup(ekf->gain_table, ekf->state.soc, ekf->internal.K);
+    } else if (ekf->internal.gain_frozen) {
+        /* 정상 상태 모드: 고정 게인의 S로 NIS 평균을 추적하여 모델 불일치 감지 */
+        real_T nis = ekf->internal.innovation * ekf->internal.innovation / ekf->internal.innovation_covariance;
+        real_T f = ekf->steady.nis_forgetting;
+        
+        ekf->internal.nis_average = f * ekf->internal.nis_average + (1.0 - f) * nis;
+        if (ekf->internal.nis_average > ekf->steady.nis_threshold) {
+            /* 이번 스텝의 예측에서 생략한 공분산 전파를 보충한 뒤 전체 업데이트 */
+            EKF_ReleaseGain(ekf);
+            Matrix2x2_CovariancePredict(ekf->internal.F, ekf->internal.P,
+                                        ekf->params.Q, ekf->internal.P);
+        }
+    }
     
-    /* 칼만 게인 계산: K = P * H^T * S^(-1) */
-    if (ekf->internal.innovation_covariance > 1e-10) {
-        real_T S_inv = 1.0 / ekf->internal.innovation_covariance;
+    if (!ekf->internal.gain_frozen && ekf->gain_table == NULL) {
+        real_T K_prev[2] = { ekf->internal.K[0], ekf->internal.K[1] };
+        
+        /* 혁신 공분산 계산: S = H * P * H^T + R */
+        real_T H_P[2];
+        H_P[0] = ekf->internal.H[0] * ekf->internal.P[0] + ekf->internal.H[1] * ekf->internal.P[1];
+        H_P[1] = ekf->internal.H[0] * ekf->internal.P[2] + ekf->internal.H[1] * ekf->internal.P[3];
+        
+        ekf->internal.innovation_covariance = H_P[0] * ekf->internal.H[0] + H_P[1] * ekf->internal.H[1] + ekf->params.R;
+        
+        /* 칼만 게인 계산: K = P * H^T * S^(-1) */
+        if (ekf->internal.innovation_covariance > 1e-10) {
+            real_T S_inv = 1.0 / ekf->internal.innovation_covariance;
+            
+            ekf->internal.K[0] = (ekf->internal.P[0] * ekf->internal.H[0] + ekf->internal.P[1] * ekf->internal.H[1]) * S_inv;
+            ekf->internal.K[1] = (ekf->internal.P[2] * ekf->internal.H[0] + ekf->internal.P[3] * ekf->internal.H[1]) * S_inv;
+        }
         
-        ekf->internal.K[0] = (ekf->internal.P[0] * ekf->internal.H[0] + ekf->internal.P[1] * ekf->internal.H[1]) * S_inv;
-        ekf->internal.K[1] = (ekf->internal.P[2] * ekf->internal.H[0] + ekf->internal.P[3] * ekf->internal.H[1]) * S_inv;
+        /* 게인 수렴 판정: 연속 hold_steps 스텝 동안 상대 변화가 허용 오차 이내이면 고정 */
+        if (ekf->steady.enable) {
+            real_T tol = ekf->steady.gain_tolerance;
+            boolean_T converged =
+                fabs(ekf->internal.K[0] - K_prev[0]) <= tol * fmax(fabs(ekf->internal.K[0]), EKF_GAIN_FLOOR) &&
+                fabs(ekf->internal.K[1] - K_prev[1]) <= tol * fmax(fabs(ekf->internal.K[1]), EKF_GAIN_FLOOR);
+            
+            ekf->internal.converged_steps = converged ? ekf->internal.converged_steps + 1 : 0;
+        }
     }
     
     /* 상태 업데이트: x = x + K * innovation */
@@ -171,24 +365,19 @@ void EKF_Update(EKF_T* ekf, real_T voltage_measured, real_T current_measured)
         ekf->state.voltage_error = EKF_MIN_VOLTAGE_ERROR;
     }
     
-    /* 공분산 업데이트: P = (I - K * H) * P */
-    real_T I_KH[4];
-    real_T P_update[4];
-    
-    /* I - K * H 계산 */
-    I_KH[0] = 1.0 - ekf->internal.K[0] * ekf->internal.H[0];
-    I_KH[1] = 0.0 - ekf->internal.K[0] * ekf->internal.H[1];
-    I_KH[2] = 0.0 - ekf->internal.K[1] * ekf->internal.H[0];
-    I_KH[3] = 1.0 - ekf->internal.K[1] * ekf->internal.H[1];
+    if (ekf->internal.gain_frozen || ekf->gain_table != NULL) {
+        return;
+    }
     
-    /* (I - K * H) * P 계산 */
-    P_update[0] = I_KH[0] * ekf->internal.P[0] + I_KH[1] * ekf->internal.P[2];
-    P_update[1] = I_KH[0] * ekf->internal.P[1] + I_KH[1] * ekf->internal.P[3];
-    P_update[2] = I_KH[2] * ekf->internal.P[0] + I_KH[3] * ekf->internal.P[2];
-    P_update[3] = I_KH[2] * ekf->internal.P[1] + I_KH[3] * ekf->internal.P[3];
+    /* 공분산 업데이트: P = (I - K * H) * P (융합 연산, 제자리 갱신) */
+    Matrix2x2_CovarianceUpdate(ekf->internal.K, ekf->internal.H,
+                               ekf->internal.P, ekf->internal.P);
     
-    /* 공분산 업데이트 */
-    memcpy(ekf->internal.P, P_update, sizeof(P_update));
+    /* 수렴이 확인되면 다음 스텝부터 고정 게인 사용 */
+    if (ekf->steady.enable && ekf->internal.converged_steps >= ekf->steady.hold_steps) {
+        ekf->internal.gain_frozen = true;
+        ekf->internal.nis_average = EKF_NIS_EXPECTED;
+    }
 }
 
 /**
@@ -207,6 +396,19 @@ void EKF_Step(EKF_T* ekf, real_T voltage_measured, real_T current_measured, real
     EKF_Update(ekf, voltage_measured, current_measured);
 }
 
+/**
+ * @brief EKF 해제
+ */
+void EKF_Cleanup(EKF_T* ekf)
+{
+    if (ekf == NULL) {
+        return;
+    }
+    
+    ekf->gain_table = NULL;
+    ekf->initialized = false;
+}
+
 /**
  * @brief 현재 SoC 값 반환
  */
@@ -227,6 +429,14 @@ void EKF_PrintStatus(const EKF_T* ekf)
         return;
     }
     
-    /* 현재는 빈 함수로 구현 - 필요시 printf 등으로 확장 */
-    (void)ekf; /* 컴파일러 경고 방지 */
+    const EKF_Internal_T* in = &ekf->internal;
+    const char* mode = (ekf->gain_table != NULL) ? "게인 스케줄링" :
+                       (in->gain_frozen ? "정상 상태 고정 게인" : "전체 공분산 전파");
+    
+    printf("EKF SoC: %.6f, 전압 오차: %.6f V\n", ekf->state.soc, ekf->state.voltage_error);
+    printf("EKF P: [%.3e %.3e; %.3e %.3e]\n", in->P[0], in->P[1], in->P[2], in->P[3]);
+    printf("EKF K: [%.3e; %.3e], 혁신: %.3e, 혁신 공분산: %.3e\n",
+           in->K[0], in->K[1], in->innovation, in->innovation_covariance);
+    printf("EKF 게인 모드: %s (수렴 %u 스텝, NIS 평균 %.3f)\n",
+           mode, (unsigned)in->converged_steps, in->nis_average);
 }
@@ -0,0 +1,160 @@
+/*
+ * ekf_gain_table.c
+ *
+ * EKF 게인 스케줄링 모듈 구현
+ */
+
+#include "ekf_gain_table.h"
+#include "matrix_ops.h"
+#include <string.h>
+#include <math.h>
+
+/* 상수 정의 */
+#define EKF_GAIN_TABLE_MAX_POINTS  10000   /* 최대 격자점 개수 (lookup_table과 동일) */
+#define EKF_GAIN_FLOOR             1e-12   /* 수렴 판정 시 최소 기준 크기 */
+
+/**
+ * @brief 한 격자점에서 리카티 반복으로 정상 상태 게인 계산
+ * @param P 입력: 초기 공분산 / 출력: 수렴한 사후 공분산
+ * @return 수렴 여부
+ */
+static boolean_T EKF_GainTable_Solve(const real_T* F, const real_T* H, const EKF_Params_T* params,
+                                     real_T* P, real_T* K)
+{
+    real_T K_prev[2] = { 0.0, 0.0 };
+
+    for (uint32_T iter = 0; iter < EKF_GAIN_TABLE_MAX_ITERATIONS; iter++) {
+        /* 예측: P = F * P * F^T + Q */
+        Matrix2x2_CovariancePredict(F, P, params->Q, P);
+
+        /* 게인: K = P * H^T / (H * P * H^T + R) */
+        real_T PHt[2];
+        PHt[0] = P[0] * H[0] + P[1] * H[1];
+        PHt[1] = P[2] * H[0] + P[3] * H[1];
+
+        real_T S = H[0] * PHt[0] + H[1] * PHt[1] + params->R;
+        if (S <= 1e-10) {
+            return false;
+        }
+
+        K[0] = PHt[0] / S;
+        K[1] = PHt[1] / S;
+
+        /* 업데이트: P = (I - K * H) * P */
+        Matrix2x2_CovarianceUpdate(K, H, P, P);
+
+        if (fabs(K[0] - K_prev[0]) <= EKF_GAIN_TABLE_TOLERANCE * fmax(fabs(K[0]), EKF_GAIN_FLOOR) &&
+            fabs(K[1] - K_prev[1]) <= EKF_GAIN_TABLE_TOLERANCE * fmax(fabs(K[1]), EKF_GAIN_FLOOR)) {
+            return true;
+        }
+
+        K_prev[0] = K[0];
+        K_prev[1] = K[1];
+    }
+
+    return false;
+}
+
+/**
+ * @brief SoC 격자별 정상 상태 칼만 게인 계산 (오프라인)
+ */
+uint32_T EKF_GainTable_Compute(const EKF_Params_T* params, const real_T* soc_grid,
+                               uint32_T num_points, real_T* gain_soc, real_T* gain_error)
+{
+    if (params == NULL || soc_grid == NULL || gain_soc == NULL || gain_error == NULL) {
+        return num_points;
+    }
+
+    /* EKF_Predict와 같은 상태 전이 행렬 (공칭 dt) */
+    real_T F[4];
+    F[0] = 1.0;
+    F[1] = -params->dt / (params->capacity * 3600.0);
+    F[2] = 0.0;
+    F[3] = 1.0;
+
+    /* 첫 격자점은 EKF_Initialize와 같은 초기 공분산에서 시작 */
+    real_T P[4] = { 1.0, 0.0, 0.0, 1.0 };
+    uint32_T failed = 0;
+
+    for (uint32_T i = 0; i < num_points; i++) {
+        real_T H[2];
+        real_T K[2] = { 0.0, 0.0 };
+
+        /* 실행 중 EKF_Update와 같은 측정 모델 */
+        EKF_GetMeasurementJacobian(soc_grid[i], H);
+
+        if (!EKF_GainTable_Solve(F, H, params, P, K)) {
+            failed++;
+        }
+
+        gain_soc[i] = K[0];
+        gain_error[i] = K[1];
+    }
+
+    return failed;
+}
+
+/**
+ * @brief 게인 테이블 초기화
+ */
+boolean_T EKF_GainTable_Initialize(EKF_GainTable_T* table, const real_T* soc_grid,
+                                   const real_T* gain_soc, const real_T* gain_error,
+                                   uint32_T num_points)
+{
+    if (table == NULL || soc_grid == NULL || gain_soc == NULL || gain_error == NULL) {
+        return false;
+    }
+
+    memset(table, 0, sizeof(EKF_GainTable_T));
+
+    LookupTable_Params_T table_params;
+    table_params.max_points = EKF_GAIN_TABLE_MAX_POINTS;
+    table_params.use_binary_search = true;
+    table_params.enable_extrapolation = false;
+
+    if (!LookupTable_Initialize(&table->gain_soc, &table_params, soc_grid, gain_soc, num_points)) {
+        return false;
+    }
+
+    if (!LookupTable_Initialize(&table->gain_error, &table_params, soc_grid, gain_error, num_points)) {
+        LookupTable_Cleanup(&table->gain_soc);
+        return false;
+    }
+
+    table->initialized = true;
+    return true;
+}
+
+/**
+ * @brief 게인 테이블 해제 (메모리 정리)
+ */
+void EKF_GainTable_Cleanup(EKF_GainTable_T* table)
+{
+    if (table == NULL) {
+        return;
+    }
+
+    LookupTable_Cleanup(&table->gain_error);
+    LookupTable_Cleanup(&table->gain_soc);
+    table->initialized = false;
+}
+
+/**
+ * @brief SoC에 해당하는 게인 보간
+ */
+void EKF_GainTable_Lookup(const EKF_GainTable_T* table, real_T soc, real_T* K)
+{
+    if (table == NULL || K == NULL || !table->initialized) {
+        return;
+    }
+
+    /* 두 테이블이 같은 격자를 공유하므로 검색은 한 번만 수행 */
+    uint32_T index;
+    real_T fraction;
+
+    K[0] = LookupTable_InterpolateAdvanced(&table->gain_soc, soc, &index, &fraction);
+
+    real_T y1 = table->gain_error.table_data[index];
+    real_T y2 = table->gain_error.table_data[index + 1];
+    K[1] = y1 + fraction * (y2 - y1);
+}
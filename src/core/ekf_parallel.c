@@ -0,0 +1,665 @@
+/*
+ * ekf_parallel.c
+ *
+ * 시간 병렬 EKF 모듈 구현
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ekf_parallel.h"
+#include "matrix_ops.h"
+#include "mem_account.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if !defined(_WIN32)
+    #include <pthread.h>
+    #include <unistd.h>
+    #define EKF_PARALLEL_HAVE_THREADS  1
+#endif
+
+/* 상수 정의 (ekf.c와 동일한 범위 제한) */
+#define EKF_PARALLEL_MIN_SOC       0.0
+#define EKF_PARALLEL_MAX_SOC       1.0
+#define EKF_PARALLEL_MIN_ERROR    -1.0
+#define EKF_PARALLEL_MAX_ERROR     1.0
+
+#define EKF_PARALLEL_DEFAULT_ITERATIONS  8
+#define EKF_PARALLEL_DEFAULT_TOLERANCE   1e-9
+
+/* 스텝별 범위 제한 활성 비트 (재선형화 지점) */
+#define EKF_CLAMP_PRED_SOC_MAX     0x01u   /* 예측 SoC 상한 */
+#define EKF_CLAMP_PRED_SOC_MIN     0x02u   /* 예측 SoC 하한 */
+#define EKF_CLAMP_SOC_MAX          0x04u   /* 업데이트 후 SoC 상한 */
+#define EKF_CLAMP_SOC_MIN          0x08u   /* 업데이트 후 SoC 하한 */
+#define EKF_CLAMP_ERROR_MAX        0x10u   /* 업데이트 후 전압 오차 상한 */
+#define EKF_CLAMP_ERROR_MIN        0x20u   /* 업데이트 후 전압 오차 하한 */
+
+/* 공분산 스캔 요소 (A, C, J) */
+typedef struct {
+    real_T A[4];
+    real_T C[4];
+    real_T J[4];
+} EKF_Parallel_Element_T;
+
+/* 모든 청크가 공유하는 입력 (읽기 전용, K와 clamp는 청크별 구간만 씀) */
+typedef struct {
+    const real_T* voltage;
+    const real_T* current;
+    real_T* soc_out;
+    real_T* K;                     /* 스텝별 칼만 게인 (2n) */
+    uint8_T* clamp;                /* 스텝별 범위 제한 비트 (n) */
+    real_T c;                      /* -dt / (capacity * 3600) */
+    real_T F[4];
+    real_T Q[4];
+    real_T H[2];
+    real_T R;
+    real_T P0[4];                  /* 첫 스텝 이전 공분산 */
+} EKF_Parallel_Job_T;
+
+/* 청크 (작업 스레드 하나가 담당) */
+typedef struct EKF_Parallel_Chunk_T EKF_Parallel_Chunk_T;
+struct EKF_Parallel_Chunk_T {
+    const EKF_Parallel_Job_T* job;
+    size_t begin;
+    size_t end;
+    void (*phase)(EKF_Parallel_Chunk_T*);
+
+    /* 공분산 */
+    EKF_Parallel_Element_T aggregate;
+    real_T P_entry[4];
+    real_T P_exit[4];
+    real_T S_exit;
+
+    /* 상태 */
+    real_T M[4];                   /* 청크 아핀 사상 x_exit = M * x_entry + u */
+    real_T u[2];
+    real_T x_entry[2];
+    real_T x_exit[2];
+    real_T innovation_exit;
+    uint32_T changed;              /* 이번 스캔에서 범위 제한 비트가 바뀐 스텝 수 */
+};
+
+/* ========================================================================
+ * 2x2 보조 연산 (행 우선)
+ * ======================================================================== */
+
+static void EKF_Parallel_Identity(real_T* A)
+{
+    A[0] = 1.0; A[1] = 0.0;
+    A[2] = 0.0; A[3] = 1.0;
+}
+
+static void EKF_Parallel_MultiplyTransB(const real_T* A, const real_T* B, real_T* C)
+{
+    real_T c0 = A[0] * B[0] + A[1] * B[1];
+    real_T c1 = A[0] * B[2] + A[1] * B[3];
+    real_T c2 = A[2] * B[0] + A[3] * B[1];
+    real_T c3 = A[2] * B[2] + A[3] * B[3];
+    C[0] = c0; C[1] = c1; C[2] = c2; C[3] = c3;
+}
+
+static void EKF_Parallel_MultiplyTransA(const real_T* A, const real_T* B, real_T* C)
+{
+    real_T c0 = A[0] * B[0] + A[2] * B[2];
+    real_T c1 = A[0] * B[1] + A[2] * B[3];
+    real_T c2 = A[1] * B[0] + A[3] * B[2];
+    real_T c3 = A[1] * B[1] + A[3] * B[3];
+    C[0] = c0; C[1] = c1; C[2] = c2; C[3] = c3;
+}
+
+static void EKF_Parallel_Symmetrize(real_T* A)
+{
+    real_T off = 0.5 * (A[1] + A[2]);
+    A[1] = off;
+    A[2] = off;
+}
+
+/* ========================================================================
+ * 공분산 스캔 요소
+ * ======================================================================== */
+
+/**
+ * @brief 일반 스텝 요소: S = HQH^T + R, K = QH^T/S
+ * A = (I - KH)F, C = (I - KH)Q, J = (HF)^T (HF) / S
+ */
+static void EKF_Parallel_StepElement(const EKF_Parallel_Job_T* job, EKF_Parallel_Element_T* e)
+{
+    const real_T* F = job->F;
+    const real_T* Q = job->Q;
+    const real_T* H = job->H;
+
+    real_T QHt[2] = { Q[0] * H[0] + Q[1] * H[1], Q[2] * H[0] + Q[3] * H[1] };
+    real_T S = H[0] * QHt[0] + H[1] * QHt[1] + job->R;
+    real_T K[2] = { QHt[0] / S, QHt[1] / S };
+
+    real_T IKH[4] = { 1.0 - K[0] * H[0], -K[0] * H[1], -K[1] * H[0], 1.0 - K[1] * H[1] };
+    Matrix2x2_Multiply(IKH, F, e->A);
+    Matrix2x2_Multiply(IKH, Q, e->C);
+    EKF_Parallel_Symmetrize(e->C);
+
+    real_T HF[2] = { H[0] * F[0] + H[1] * F[2], H[0] * F[1] + H[1] * F[3] };
+    e->J[0] = HF[0] * HF[0] / S;
+    e->J[1] = HF[0] * HF[1] / S;
+    e->J[2] = e->J[1];
+    e->J[3] = HF[1] * HF[1] / S;
+}
+
+/**
+ * @brief 첫 스텝 요소: 사전 공분산 P0를 흡수하여 A = 0, J = 0, C = 필터 공분산
+ */
+static void EKF_Parallel_FirstElement(const EKF_Parallel_Job_T* job, EKF_Parallel_Element_T* e)
+{
+    const real_T* H = job->H;
+    real_T P[4];
+
+    Matrix2x2_CovariancePredict(job->F, job->P0, job->Q, P);
+
+    real_T PHt[2] = { P[0] * H[0] + P[1] * H[1], P[2] * H[0] + P[3] * H[1] };
+    real_T S = H[0] * PHt[0] + H[1] * PHt[1] + job->R;
+    real_T K[2] = { PHt[0] / S, PHt[1] / S };
+
+    Matrix2x2_CovarianceUpdate(K, H, P, e->C);
+    EKF_Parallel_Symmetrize(e->C);
+    memset(e->A, 0, sizeof(e->A));
+    memset(e->J, 0, sizeof(e->J));
+}
+
+/**
+ * @brief 요소 결합 out = a (앞) ⊗ b (뒤)
+ * T = (I + C_a J_b)^-1
+ * A = A_b T A_a
+ * C = A_b T C_a A_b^T + C_b
+ * J = (T A_a)^T J_b A_a + J_a      ((I + J_b C_a)^-1 = T^T)
+ */
+static void EKF_Parallel_Combine(const EKF_Parallel_Element_T* a, const EKF_Parallel_Element_T* b,
+                                 EKF_Parallel_Element_T* out)
+{
+    real_T CJ[4];
+    real_T T[4];
+    real_T AT[4];
+    real_T tmp[4];
+    real_T A[4], C[4], J[4];
+
+    Matrix2x2_Multiply(a->C, b->J, CJ);
+    CJ[0] += 1.0;
+    CJ[3] += 1.0;
+    if (!Matrix2x2_Inverse(CJ, T)) {
+        /* C, J가 양의 준정부호이면 발생하지 않음 */
+        EKF_Parallel_Identity(T);
+    }
+
+    Matrix2x2_Multiply(b->A, T, AT);
+    Matrix2x2_Multiply(AT, a->A, A);
+
+    Matrix2x2_Multiply(AT, a->C, tmp);
+    EKF_Parallel_MultiplyTransB(tmp, b->A, C);
+    Matrix2x2_Add(C, b->C, C);
+    EKF_Parallel_Symmetrize(C);
+
+    real_T TA[4];
+    Matrix2x2_Multiply(T, a->A, TA);
+    Matrix2x2_Multiply(b->J, a->A, tmp);
+    EKF_Parallel_MultiplyTransA(TA, tmp, J);
+    Matrix2x2_Add(J, a->J, J);
+    EKF_Parallel_Symmetrize(J);
+
+    memcpy(out->A, A, sizeof(A));
+    memcpy(out->C, C, sizeof(C));
+    memcpy(out->J, J, sizeof(J));
+}
+
+/**
+ * @brief 같은 요소 count개의 결합 (거듭제곱, O(log count))
+ * dt가 일정하면 모든 스텝의 요소가 같으므로 청크 축약을 로그 시간에 수행
+ */
+static void EKF_Parallel_ElementPower(const EKF_Parallel_Element_T* e, size_t count,
+                                      EKF_Parallel_Element_T* out)
+{
+    EKF_Parallel_Element_T base = *e;
+    boolean_T have = false;
+
+    while (count > 0) {
+        if (count & 1u) {
+            if (have) {
+                EKF_Parallel_Combine(out, &base, out);
+            } else {
+                *out = base;
+                have = true;
+            }
+        }
+        count >>= 1;
+        if (count > 0) {
+            EKF_Parallel_Combine(&base, &base, &base);
+        }
+    }
+}
+
+/* ========================================================================
+ * 상태 아핀 사상
+ * ======================================================================== */
+
+/**
+ * @brief 아핀 사상의 한 행을 상수로 고정 (범위 제한 선형화)
+ */
+static void EKF_Parallel_FixRow(real_T* M, real_T* u, uint32_T row, real_T value)
+{
+    M[row * 2] = 0.0;
+    M[row * 2 + 1] = 0.0;
+    u[row] = value;
+}
+
+/**
+ * @brief 스텝 k의 아핀 사상 (게인과 범위 제한 비트 기준)
+ * 예측: soc += c * I, 업데이트: x += K * (-voltage_error)
+ */
+static void EKF_Parallel_StepMap(const EKF_Parallel_Job_T* job, size_t k, real_T* M, real_T* u)
+{
+    uint32_T clamp = job->clamp[k];
+    const real_T* K = &job->K[2 * k];
+
+    /* 예측 */
+    real_T Mp[4];
+    real_T up[2] = { job->c * job->current[k], 0.0 };
+    EKF_Parallel_Identity(Mp);
+    if (clamp & EKF_CLAMP_PRED_SOC_MAX) {
+        EKF_Parallel_FixRow(Mp, up, 0, EKF_PARALLEL_MAX_SOC);
+    } else if (clamp & EKF_CLAMP_PRED_SOC_MIN) {
+        EKF_Parallel_FixRow(Mp, up, 0, EKF_PARALLEL_MIN_SOC);
+    }
+
+    /* 업데이트: [1 -K0; 0 1-K1] */
+    real_T Mu[4] = { 1.0, -K[0], 0.0, 1.0 - K[1] };
+    Matrix2x2_Multiply(Mu, Mp, M);
+    u[0] = Mu[0] * up[0] + Mu[1] * up[1];
+    u[1] = Mu[2] * up[0] + Mu[3] * up[1];
+
+    /* 업데이트 후 범위 제한 */
+    if (clamp & EKF_CLAMP_SOC_MAX) {
+        EKF_Parallel_FixRow(M, u, 0, EKF_PARALLEL_MAX_SOC);
+    } else if (clamp & EKF_CLAMP_SOC_MIN) {
+        EKF_Parallel_FixRow(M, u, 0, EKF_PARALLEL_MIN_SOC);
+    }
+    if (clamp & EKF_CLAMP_ERROR_MAX) {
+        EKF_Parallel_FixRow(M, u, 1, EKF_PARALLEL_MAX_ERROR);
+    } else if (clamp & EKF_CLAMP_ERROR_MIN) {
+        EKF_Parallel_FixRow(M, u, 1, EKF_PARALLEL_MIN_ERROR);
+    }
+}
+
+/* ========================================================================
+ * 청크 단계
+ * ======================================================================== */
+
+/**
+ * @brief 상태 1단계: 청크 아핀 사상 합성
+ */
+static void EKF_Parallel_ReduceMean(EKF_Parallel_Chunk_T* chunk)
+{
+    EKF_Parallel_Identity(chunk->M);
+    chunk->u[0] = 0.0;
+    chunk->u[1] = 0.0;
+
+    for (size_t k = chunk->begin; k < chunk->end; k++) {
+        real_T Ms[4], us[2];
+        EKF_Parallel_StepMap(chunk->job, k, Ms, us);
+
+        /* (Ms, us) ∘ (M, u) = (Ms * M, Ms * u + us) */
+        real_T u0 = Ms[0] * chunk->u[0] + Ms[1] * chunk->u[1] + us[0];
+        real_T u1 = Ms[2] * chunk->u[0] + Ms[3] * chunk->u[1] + us[1];
+        Matrix2x2_Multiply(Ms, chunk->M, chunk->M);
+        chunk->u[0] = u0;
+        chunk->u[1] = u1;
+    }
+}
+
+/**
+ * @brief 공분산 1단계: 청크 요소 축약
+ */
+static void EKF_Parallel_ReduceCovariance(EKF_Parallel_Chunk_T* chunk)
+{
+    EKF_Parallel_Element_T step;
+    size_t count = chunk->end - chunk->begin;
+
+    EKF_Parallel_StepElement(chunk->job, &step);
+
+    if (chunk->begin == 0) {
+        EKF_Parallel_FirstElement(chunk->job, &chunk->aggregate);
+        if (count > 1) {
+            EKF_Parallel_Element_T rest;
+            EKF_Parallel_ElementPower(&step, count - 1, &rest);
+            EKF_Parallel_Combine(&chunk->aggregate, &rest, &chunk->aggregate);
+        }
+    } else {
+        EKF_Parallel_ElementPower(&step, count, &chunk->aggregate);
+    }
+}
+
+/**
+ * @brief 공분산 3단계: 청크 입구 공분산에서 순차 리카티 전파 후 게인 저장
+ */
+static void EKF_Parallel_ScanCovariance(EKF_Parallel_Chunk_T* chunk)
+{
+    const EKF_Parallel_Job_T* job = chunk->job;
+    const real_T* H = job->H;
+    real_T P[4];
+    real_T S = 1.0;
+
+    memcpy(P, chunk->P_entry, sizeof(P));
+
+    for (size_t k = chunk->begin; k < chunk->end; k++) {
+        real_T* K = &job->K[2 * k];
+
+        /* EKF_Predict / EKF_Update와 같은 순서와 연산 */
+        Matrix2x2_CovariancePredict(job->F, P, job->Q, P);
+
+        real_T H_P[2];
+        H_P[0] = H[0] * P[0] + H[1] * P[1];
+        H_P[1] = H[0] * P[2] + H[1] * P[3];
+        S = H_P[0] * H[0] + H_P[1] * H[1] + job->R;
+
+        real_T S_inv = 1.0 / S;
+        K[0] = (P[0] * H[0] + P[1] * H[1]) * S_inv;
+        K[1] = (P[2] * H[0] + P[3] * H[1]) * S_inv;
+
+        Matrix2x2_CovarianceUpdate(K, H, P, P);
+    }
+
+    memcpy(chunk->P_exit, P, sizeof(P));
+    chunk->S_exit = S;
+}
+
+/**
+ * @brief 상태 3단계: 청크 입구 상태에서 실제 (비선형) 스텝을 순차 실행
+ * 실제로 걸린 범위 제한 비트를 기록하여 다음 반복의 선형화에 사용
+ */
+static void EKF_Parallel_ScanMean(EKF_Parallel_Chunk_T* chunk)
+{
+    const EKF_Parallel_Job_T* job = chunk->job;
+    real_T soc = chunk->x_entry[0];
+    real_T error = chunk->x_entry[1];
+    real_T innovation = 0.0;
+    uint32_T changed = 0;
+
+    for (size_t k = chunk->begin; k < chunk->end; k++) {
+        const real_T* K = &job->K[2 * k];
+        uint32_T clamp = 0;
+
+        /* 예측 */
+        soc = soc + job->c * job->current[k];
+        if (soc > EKF_PARALLEL_MAX_SOC) {
+            soc = EKF_PARALLEL_MAX_SOC;
+            clamp |= EKF_CLAMP_PRED_SOC_MAX;
+        } else if (soc < EKF_PARALLEL_MIN_SOC) {
+            soc = EKF_PARALLEL_MIN_SOC;
+            clamp |= EKF_CLAMP_PRED_SOC_MIN;
+        }
+
+        /* 업데이트 */
+        real_T voltage_predicted = job->voltage[k] + error;
+        innovation = job->voltage[k] - voltage_predicted;
+        soc += K[0] * innovation;
+        error += K[1] * innovation;
+
+        if (soc > EKF_PARALLEL_MAX_SOC) {
+            soc = EKF_PARALLEL_MAX_SOC;
+            clamp |= EKF_CLAMP_SOC_MAX;
+        } else if (soc < EKF_PARALLEL_MIN_SOC) {
+            soc = EKF_PARALLEL_MIN_SOC;
+            clamp |= EKF_CLAMP_SOC_MIN;
+        }
+        if (error > EKF_PARALLEL_MAX_ERROR) {
+            error = EKF_PARALLEL_MAX_ERROR;
+            clamp |= EKF_CLAMP_ERROR_MAX;
+        } else if (error < EKF_PARALLEL_MIN_ERROR) {
+            error = EKF_PARALLEL_MIN_ERROR;
+            clamp |= EKF_CLAMP_ERROR_MIN;
+        }
+
+        if (job->clamp[k] != clamp) {
+            job->clamp[k] = (uint8_T)clamp;
+            changed++;
+        }
+        if (job->soc_out != NULL) {
+            job->soc_out[k] = soc;
+        }
+    }
+
+    chunk->x_exit[0] = soc;
+    chunk->x_exit[1] = error;
+    chunk->innovation_exit = innovation;
+    chunk->changed = changed;
+}
+
+/**
+ * @brief 공분산 3단계 + 초기 선형화
+ * 게인이 정해지면 같은 스레드에서 공칭 입구 상태(청크 0 외에는 추정값)로
+ * 청크를 한 번 실행하여 범위 제한 비트를 얻고, 그 궤적 기준으로 아핀 사상을 합성
+ */
+static void EKF_Parallel_Prepare(EKF_Parallel_Chunk_T* chunk)
+{
+    EKF_Parallel_ScanCovariance(chunk);
+    EKF_Parallel_ScanMean(chunk);
+    EKF_Parallel_ReduceMean(chunk);
+}
+
+/**
+ * @brief 이전 청크의 아핀 사상으로 다음 청크 입구 상태 계산
+ * 전압 오차 모드는 범위 제한 없이 불안정(|1 - K[1]| > 1)할 수 있어 긴 청크의 M이
+ * 무한대가 되므로, 0인 상태 성분의 항은 곱하지 않음 (inf * 0 = NaN 방지)
+ */
+static void EKF_Parallel_Advance(const EKF_Parallel_Chunk_T* prev, real_T* x)
+{
+    const real_T* M = prev->M;
+    real_T x0 = prev->x_entry[0];
+    real_T x1 = prev->x_entry[1];
+
+    x[0] = prev->u[0] + ((x0 != 0.0) ? M[0] * x0 : 0.0) + ((x1 != 0.0) ? M[1] * x1 : 0.0);
+    x[1] = prev->u[1] + ((x0 != 0.0) ? M[2] * x0 : 0.0) + ((x1 != 0.0) ? M[3] * x1 : 0.0);
+}
+
+/* ========================================================================
+ * 스레드 실행
+ * ======================================================================== */
+
+#ifdef EKF_PARALLEL_HAVE_THREADS
+static void* EKF_Parallel_Thread(void* arg)
+{
+    EKF_Parallel_Chunk_T* chunk = (EKF_Parallel_Chunk_T*)arg;
+    chunk->phase(chunk);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief 모든 청크에서 한 단계를 병렬 실행 (청크 0은 호출 스레드가 담당)
+ */
+static void EKF_Parallel_Run(EKF_Parallel_Chunk_T* chunks, uint32_T count,
+                             void (*phase)(EKF_Parallel_Chunk_T*))
+{
+#ifdef EKF_PARALLEL_HAVE_THREADS
+    pthread_t threads[EKF_PARALLEL_MAX_THREADS];
+    boolean_T started[EKF_PARALLEL_MAX_THREADS];
+
+    for (uint32_T i = 1; i < count; i++) {
+        chunks[i].phase = phase;
+        started[i] = (boolean_T)(pthread_create(&threads[i], NULL, EKF_Parallel_Thread, &chunks[i]) == 0);
+    }
+
+    phase(&chunks[0]);
+
+    for (uint32_T i = 1; i < count; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            /* 스레드를 만들지 못한 청크는 호출 스레드에서 실행 */
+            phase(&chunks[i]);
+        }
+    }
+#else
+    for (uint32_T i = 0; i < count; i++) {
+        phase(&chunks[i]);
+    }
+#endif
+}
+
+/**
+ * @brief 사용할 청크 개수 결정
+ */
+static uint32_T EKF_Parallel_ChunkCount(const EKF_Parallel_Config_T* config, size_t n)
+{
+    uint32_T threads = config->num_threads;
+
+#ifdef EKF_PARALLEL_HAVE_THREADS
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (uint32_T)online : 1;
+    }
+#else
+    threads = 1;
+#endif
+
+    if (threads > EKF_PARALLEL_MAX_THREADS) {
+        threads = EKF_PARALLEL_MAX_THREADS;
+    }
+
+    size_t by_size = n / EKF_PARALLEL_MIN_CHUNK;
+    if (by_size < threads) {
+        threads = (by_size > 0) ? (uint32_T)by_size : 1;
+    }
+    return threads;
+}
+
+/* ========================================================================
+ * 공개 함수
+ * ======================================================================== */
+
+/**
+ * @brief 측정 기록 전체를 시간 병렬로 필터링
+ */
+uint32_T EKF_FilterParallel(EKF_T* ekf, const real_T* voltage, const real_T* current,
+                            size_t n, real_T dt, const EKF_Parallel_Config_T* config,
+                            real_T* soc_out)
+{
+    if (ekf == NULL || voltage == NULL || current == NULL || !ekf->initialized || n == 0) {
+        return 0;
+    }
+
+    EKF_Parallel_Config_T defaults = { 0, EKF_PARALLEL_DEFAULT_ITERATIONS, EKF_PARALLEL_DEFAULT_TOLERANCE };
+    if (config == NULL) {
+        config = &defaults;
+    }
+
+    EKF_Parallel_Job_T job;
+    memset(&job, 0, sizeof(job));
+    job.voltage = voltage;
+    job.current = current;
+    job.soc_out = soc_out;
+    job.K = (real_T*)Mem_Alloc(NULL, 2 * n * sizeof(real_T));
+    job.clamp = (uint8_T*)Mem_Calloc(NULL, n, sizeof(uint8_T));
+    if (job.K == NULL || job.clamp == NULL) {
+        Mem_Free(NULL, job.K);
+        Mem_Free(NULL, job.clamp);
+        return 0;
+    }
+
+    job.c = -dt / (ekf->params.capacity * 3600.0);
+    job.F[0] = 1.0;
+    job.F[1] = job.c;
+    job.F[2] = 0.0;
+    job.F[3] = 1.0;
+    memcpy(job.Q, ekf->params.Q, sizeof(job.Q));
+    memcpy(job.H, ekf->internal.H, sizeof(job.H));
+    job.R = ekf->params.R;
+    memcpy(job.P0, ekf->internal.P, sizeof(job.P0));
+
+    /* 청크 분할 */
+    EKF_Parallel_Chunk_T chunks[EKF_PARALLEL_MAX_THREADS];
+    uint32_T count = EKF_Parallel_ChunkCount(config, n);
+
+    for (uint32_T i = 0; i < count; i++) {
+        memset(&chunks[i], 0, sizeof(EKF_Parallel_Chunk_T));
+        chunks[i].job = &job;
+        chunks[i].begin = n * i / count;
+        chunks[i].end = n * (i + 1) / count;
+    }
+
+    /* 공분산: 축약 -> 경계 스캔 -> 청크 내부 전파 (+ 공칭 궤적으로 초기 선형화) */
+    EKF_Parallel_Run(chunks, count, EKF_Parallel_ReduceCovariance);
+
+    memcpy(chunks[0].P_entry, job.P0, sizeof(job.P0));
+    EKF_Parallel_Element_T prefix = chunks[0].aggregate;
+    for (uint32_T i = 1; i < count; i++) {
+        memcpy(chunks[i].P_entry, prefix.C, sizeof(prefix.C));
+        if (i + 1 < count) {
+            EKF_Parallel_Combine(&prefix, &chunks[i].aggregate, &prefix);
+        }
+    }
+
+    for (uint32_T i = 0; i < count; i++) {
+        chunks[i].x_entry[0] = ekf->state.soc;
+        chunks[i].x_entry[1] = ekf->state.voltage_error;
+    }
+    EKF_Parallel_Run(chunks, count, EKF_Parallel_Prepare);
+
+    /* 상태: 경계 스캔 -> 청크 내부 실행, 경계가 일치할 때까지 재선형화 */
+    uint32_T iterations = 0;
+    uint32_T first_mismatch = count;
+
+    for (;;) {
+        iterations++;
+
+        for (uint32_T i = 1; i < count; i++) {
+            EKF_Parallel_Advance(&chunks[i - 1], chunks[i].x_entry);
+        }
+
+        EKF_Parallel_Run(chunks, count, EKF_Parallel_ScanMean);
+
+        first_mismatch = count;
+        for (uint32_T i = 1; i < count; i++) {
+            /* NaN도 불일치로 처리 */
+            if (!(fabs(chunks[i].x_entry[0] - chunks[i - 1].x_exit[0]) <= config->tolerance) ||
+                !(fabs(chunks[i].x_entry[1] - chunks[i - 1].x_exit[1]) <= config->tolerance)) {
+                first_mismatch = i;
+                break;
+            }
+        }
+        if (first_mismatch == count || iterations >= config->max_iterations) {
+            break;
+        }
+
+        /* 범위 제한 비트가 바뀐 청크만 아핀 사상을 다시 합성 */
+        for (uint32_T i = 0; i < count; i++) {
+            if (chunks[i].changed > 0) {
+                EKF_Parallel_ReduceMean(&chunks[i]);
+            }
+        }
+    }
+
+    /* 반복 한도 안에 수렴하지 못하면 어긋난 청크부터 순차 보정 */
+    for (uint32_T i = first_mismatch; i < count; i++) {
+        chunks[i].x_entry[0] = chunks[i - 1].x_exit[0];
+        chunks[i].x_entry[1] = chunks[i - 1].x_exit[1];
+        EKF_Parallel_ScanMean(&chunks[i]);
+    }
+
+    /* 마지막 스텝 이후 EKF 상태 반영 (EKF_Step n회 호출과 동일) */
+    const EKF_Parallel_Chunk_T* last = &chunks[count - 1];
+    ekf->state.soc = last->x_exit[0];
+    ekf->state.voltage_error = last->x_exit[1];
+    memcpy(ekf->internal.P, last->P_exit, sizeof(ekf->internal.P));
+    ekf->internal.F[1] = job.c;
+    ekf->internal.K[0] = job.K[2 * (n - 1)];
+    ekf->internal.K[1] = job.K[2 * (n - 1) + 1];
+    ekf->internal.innovation = last->innovation_exit;
+    ekf->internal.innovation_covariance = last->S_exit;
+    ekf->internal.gain_frozen = false;
+    ekf->internal.converged_steps = 0;
+    ekf->internal.last_dt = dt;
+
+    Mem_Free(NULL, job.K);
+    Mem_Free(NULL, job.clamp);
+
+    return iterations;
+}
@@ -0,0 +1,292 @@
+/*
+ * ekf_smoother.c
+ *
+ * EKF 고정 구간 스무더 모듈 구현
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ekf_smoother.h"
+#include "matrix_ops.h"
+#include "mem_account.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if !defined(_WIN32)
+    #include <pthread.h>
+    #include <unistd.h>
+    #define EKF_SMOOTHER_HAVE_THREADS  1
+#endif
+
+/* 상수 정의 (ekf.c와 동일한 범위 제한) */
+#define EKF_SMOOTHER_MIN_SOC       0.0
+#define EKF_SMOOTHER_MAX_SOC       1.0
+
+/* 구간 내 필터 결과 (스텝당) */
+typedef struct {
+    EKF_State_T state;
+    real_T P[4];
+} EKF_Smoother_Filtered_T;
+
+/**
+ * @brief 구간 길이: ceil(sqrt(n))
+ */
+static size_t EKF_Smoother_SegmentLength(size_t n)
+{
+    size_t m = (size_t)sqrt((double)n);
+    while (m * m < n) {
+        m++;
+    }
+    return (m > 0) ? m : 1;
+}
+
+/**
+ * @brief 길이 n 기록의 평활에 필요한 작업 메모리 (바이트)
+ */
+size_t EKF_Smoother_WorkspaceSize(size_t n)
+{
+    size_t m = EKF_Smoother_SegmentLength(n);
+    size_t checkpoints = (n + m - 1) / m;
+
+    return checkpoints * sizeof(EKF_T) + m * sizeof(EKF_Smoother_Filtered_T);
+}
+
+/**
+ * @brief 평활 SoC를 배열에 저장하는 기본 싱크
+ */
+void EKF_Smoother_StoreSoC(void* context, size_t k, const EKF_State_T* state, const real_T* P)
+{
+    (void)P;
+    ((real_T*)context)[k] = state->soc;
+}
+
+/**
+ * @brief 한 스텝 RTS 역방향 재귀
+ * 예측: x_p = [soc + c * I, error], P_p = F * P_f * F^T + Q
+ * G = P_f * F^T * P_p^-1
+ * x_s = x_f + G * (x_s_next - x_p), P_s = P_f + G * (P_s_next - P_p) * G^T
+ */
+static void EKF_Smoother_Backward(const EKF_T* filter, const EKF_Smoother_Filtered_T* filtered,
+                                  real_T current_next, real_T* x_s, real_T* P_s)
+{
+    const real_T* F = filter->internal.F;
+    const real_T* P_f = filtered->P;
+    real_T P_p[4];
+    real_T P_p_inv[4];
+    real_T Ft[4];
+    real_T G[4];
+    real_T tmp[4];
+
+    /* 다음 스텝 예측 (EKF_Predict와 동일) */
+    real_T soc_p = filtered->state.soc + F[1] * current_next;
+    if (soc_p > EKF_SMOOTHER_MAX_SOC) {
+        soc_p = EKF_SMOOTHER_MAX_SOC;
+    } else if (soc_p < EKF_SMOOTHER_MIN_SOC) {
+        soc_p = EKF_SMOOTHER_MIN_SOC;
+    }
+    real_T error_p = filtered->state.voltage_error;
+
+    Matrix2x2_CovariancePredict(F, P_f, filter->params.Q, P_p);
+
+    /* 스무더 게인: G = P_f * F^T * P_p^-1 */
+    Matrix2x2_Transpose(F, Ft);
+    Matrix2x2_Multiply(P_f, Ft, tmp);
+    if (!Matrix2x2_Inverse(P_p, P_p_inv)) {
+        /* 예측 공분산이 특이하면 필터 결과를 그대로 사용 */
+        x_s[0] = filtered->state.soc;
+        x_s[1] = filtered->state.voltage_error;
+        memcpy(P_s, P_f, 4 * sizeof(real_T));
+        return;
+    }
+    Matrix2x2_Multiply(tmp, P_p_inv, G);
+
+    /* 상태 */
+    real_T d0 = x_s[0] - soc_p;
+    real_T d1 = x_s[1] - error_p;
+    x_s[0] = filtered->state.soc + G[0] * d0 + G[1] * d1;
+    x_s[1] = filtered->state.voltage_error + G[2] * d0 + G[3] * d1;
+
+    /* 공분산 */
+    real_T D[4];
+    real_T Gt[4];
+    Matrix2x2_Subtract(P_s, P_p, D);
+    Matrix2x2_Transpose(G, Gt);
+    Matrix2x2_Multiply(G, D, tmp);
+    Matrix2x2_Multiply(tmp, Gt, D);
+    Matrix2x2_Add(P_f, D, P_s);
+}
+
+/**
+ * @brief 고정 구간 RTS 평활
+ */
+boolean_T EKF_Smooth(const EKF_T* ekf, const real_T* voltage, const real_T* current, size_t n,
+                     real_T dt, EKF_Smoother_Sink_T sink, void* context)
+{
+    return EKF_SmoothCheckpointed(ekf, voltage, current, n, dt, 0, sink, context);
+}
+
+/**
+ * @brief 체크포인트 간격을 지정한 고정 구간 RTS 평활
+ */
+boolean_T EKF_SmoothCheckpointed(const EKF_T* ekf, const real_T* voltage, const real_T* current,
+                                 size_t n, real_T dt, size_t interval,
+                                 EKF_Smoother_Sink_T sink, void* context)
+{
+    if (ekf == NULL || voltage == NULL || current == NULL || sink == NULL || !ekf->initialized) {
+        return false;
+    }
+    if (n == 0) {
+        return true;
+    }
+
+    size_t m = (interval == 0) ? EKF_Smoother_SegmentLength(n) : ((interval < n) ? interval : n);
+    size_t segments = (n + m - 1) / m;
+
+    EKF_T* checkpoints = (EKF_T*)Mem_Alloc(NULL, segments * sizeof(EKF_T));
+    EKF_Smoother_Filtered_T* filtered = (EKF_Smoother_Filtered_T*)Mem_Alloc(NULL, m * sizeof(EKF_Smoother_Filtered_T));
+    if (checkpoints == NULL || filtered == NULL) {
+        Mem_Free(NULL, checkpoints);
+        Mem_Free(NULL, filtered);
+        return false;
+    }
+
+    /* 전체 공분산 필터 (고정 게인 / 게인 스케줄링 해제) */
+    EKF_T filter = *ekf;
+    filter.steady.enable = false;
+    filter.internal.gain_frozen = false;
+    filter.gain_table = NULL;
+
+    /* 순방향: 구간 시작마다 체크포인트 저장 */
+    for (size_t s = 0; s < segments; s++) {
+        size_t begin = s * m;
+        size_t end = (begin + m < n) ? begin + m : n;
+
+        checkpoints[s] = filter;
+        for (size_t k = begin; k < end; k++) {
+            EKF_Step(&filter, voltage[k], current[k], dt);
+        }
+    }
+
+    /* 역방향: 뒤 구간부터 체크포인트에서 재필터링 후 RTS 재귀 */
+    real_T x_s[2] = { 0.0, 0.0 };
+    real_T P_s[4] = { 0.0, 0.0, 0.0, 0.0 };
+    EKF_State_T smoothed;
+
+    for (size_t s = segments; s-- > 0;) {
+        size_t begin = s * m;
+        size_t end = (begin + m < n) ? begin + m : n;
+
+        filter = checkpoints[s];
+        for (size_t k = begin; k < end; k++) {
+            EKF_Step(&filter, voltage[k], current[k], dt);
+            filtered[k - begin].state = filter.state;
+            memcpy(filtered[k - begin].P, filter.internal.P, sizeof(filtered[k - begin].P));
+        }
+
+        for (size_t k = end; k-- > begin;) {
+            const EKF_Smoother_Filtered_T* f = &filtered[k - begin];
+
+            if (k == n - 1) {
+                /* 마지막 스텝은 필터 결과가 곧 평활 결과 */
+                x_s[0] = f->state.soc;
+                x_s[1] = f->state.voltage_error;
+                memcpy(P_s, f->P, sizeof(P_s));
+            } else {
+                EKF_Smoother_Backward(&filter, f, current[k + 1], x_s, P_s);
+            }
+
+            smoothed.soc = x_s[0];
+            smoothed.voltage_error = x_s[1];
+            if (smoothed.soc > EKF_SMOOTHER_MAX_SOC) {
+                smoothed.soc = EKF_SMOOTHER_MAX_SOC;
+            } else if (smoothed.soc < EKF_SMOOTHER_MIN_SOC) {
+                smoothed.soc = EKF_SMOOTHER_MIN_SOC;
+            }
+            sink(context, k, &smoothed, P_s);
+        }
+    }
+
+    Mem_Free(NULL, filtered);
+    Mem_Free(NULL, checkpoints);
+    return true;
+}
+
+/* ========================================================================
+ * 기록 단위 병렬 처리
+ * ======================================================================== */
+
+typedef struct {
+    const EKF_T* ekf;
+    EKF_Smoother_Trace_T* traces;
+    uint32_T count;
+    real_T dt;
+    uint32_T next;                 /* 다음에 처리할 기록 (원자적 증가) */
+} EKF_Smoother_Batch_T;
+
+static void* EKF_Smoother_Worker(void* arg)
+{
+    EKF_Smoother_Batch_T* batch = (EKF_Smoother_Batch_T*)arg;
+
+    for (;;) {
+        uint32_T i = __atomic_fetch_add(&batch->next, 1u, __ATOMIC_RELAXED);
+        if (i >= batch->count) {
+            break;
+        }
+
+        EKF_Smoother_Trace_T* trace = &batch->traces[i];
+        trace->success = EKF_Smooth(batch->ekf, trace->voltage, trace->current, trace->n,
+                                    batch->dt, trace->sink, trace->context);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 여러 기록을 스레드에 나누어 평활 (기록 단위 병렬)
+ */
+uint32_T EKF_SmoothBatch(const EKF_T* ekf, EKF_Smoother_Trace_T* traces, uint32_T count,
+                         real_T dt, uint32_T num_threads)
+{
+    if (ekf == NULL || traces == NULL) {
+        return 0;
+    }
+
+    EKF_Smoother_Batch_T batch = { ekf, traces, count, dt, 0 };
+
+#ifdef EKF_SMOOTHER_HAVE_THREADS
+    if (num_threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (online > 0) ? (uint32_T)online : 1;
+    }
+    if (num_threads > EKF_SMOOTHER_MAX_THREADS) {
+        num_threads = EKF_SMOOTHER_MAX_THREADS;
+    }
+    if (num_threads > count) {
+        num_threads = count;
+    }
+
+    pthread_t threads[EKF_SMOOTHER_MAX_THREADS];
+    boolean_T started[EKF_SMOOTHER_MAX_THREADS];
+
+    for (uint32_T t = 1; t < num_threads; t++) {
+        started[t] = (boolean_T)(pthread_create(&threads[t], NULL, EKF_Smoother_Worker, &batch) == 0);
+    }
+    EKF_Smoother_Worker(&batch);
+    for (uint32_T t = 1; t < num_threads; t++) {
+        if (started[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+#else
+    (void)num_threads;
+    EKF_Smoother_Worker(&batch);
+#endif
+
+    uint32_T succeeded = 0;
+    for (uint32_T i = 0; i < count; i++) {
+        if (traces[i].success) {
+            succeeded++;
+        }
+    }
+    return succeeded;
+}
@@ -6,6 +6,7 @@
  */
 
 #include "lookup_table.h"
+#include "mem_account.h"
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
@@ -48,8 +49,9 @@ boolean_T LookupTable_Initialize(LookupTable_T* table,
     table->initialized = false;
     
     /* 메모리 할당 */
-    table->breakpoints = (real_T*)malloc(num_points * sizeof(real_T));
-    table->table_data = (real_T*)malloc(num_points * sizeof(real_T));
+    Mem_Reset(&table->memory);
+    table->breakpoints = (real_T*)Mem_Alloc(&table->memory, num_points * sizeof(real_T));
+    table->table_data = (real_T*)Mem_Alloc(&table->memory, num_points * sizeof(real_T));
     
     if (!table->breakpoints || !table->table_data) {
         LookupTable_Cleanup(table);
@@ -61,6 +63,7 @@ boolean_T LookupTable_Initialize(LookupTable_T* table,
     memcpy(table->table_data, table_data, num_points * sizeof(real_T));
     
     /* 초기화 완료 */
+    Mem_Seal(&table->memory);
     table->initialized = true;
     
     return true;
@@ -76,12 +79,12 @@ void LookupTable_Cleanup(LookupTable_T* table)
     }
     
     if (table->breakpoints) {
-        free(table->breakpoints);
+        Mem_Free(&table->memory, table->breakpoints);
         table->breakpoints = NULL;
     }
     
     if (table->table_data) {
-        free(table->table_data);
+        Mem_Free(&table->memory, table->table_data);
         table->table_data = NULL;
     }
     
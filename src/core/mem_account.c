@@ -0,0 +1,250 @@
+/*
+ * mem_account.c
+ *
+ * 할당 계정 모듈 구현
+ * 전체 집계는 GCC __atomic 내장 함수로 갱신 (여러 스레드가 인스턴스를 만들 수 있음)
+ */
+
+#include "mem_account.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 블록 헤더 (사용자 메모리 바로 앞) */
+typedef union {
+    struct {
+        size_t size;               /* 사용자 크기 (바이트) */
+        size_t offset;             /* 원래 malloc 주소에서 사용자 메모리까지 거리 */
+    } info;
+    unsigned char pad[MEM_HEADER_SIZE];
+} Mem_Header_T;
+
+typedef char Mem_HeaderSizeCheck[(sizeof(Mem_Header_T) == MEM_HEADER_SIZE) ? 1 : -1];
+
+/* 전체 집계 */
+static size_t g_bytes;
+static size_t g_peak_bytes;
+static uint32_T g_allocations;
+static uint32_T g_frees;
+static uint32_T g_violations;
+static uint32_T g_strict;
+
+static Mem_Header_T* Mem_GetHeader(void* data)
+{
+    return (Mem_Header_T*)((unsigned char*)data - MEM_HEADER_SIZE);
+}
+
+/**
+ * @brief 할당 전 봉인 검사 (엄격 모드에서는 중단)
+ */
+static void Mem_CheckSealed(Mem_Account_T* account, size_t bytes)
+{
+    if (account == NULL || !account->sealed) {
+        return;
+    }
+
+    account->violations++;
+    __atomic_fetch_add(&g_violations, 1u, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&g_strict, __ATOMIC_RELAXED) != 0) {
+        fprintf(stderr, "Mem: 초기화 이후 할당 (%zu 바이트, 계정 %p)\n", bytes, (void*)account);
+        abort();
+    }
+}
+
+/* 할당 / 해제 집계 (grow: 이번 변경으로 늘어난 바이트, shrink: 줄어든 바이트) */
+static void Mem_Charge(Mem_Account_T* account, size_t grow, size_t shrink, boolean_T allocation, boolean_T release)
+{
+    if (account != NULL) {
+        account->bytes = account->bytes + grow - shrink;
+        if (account->bytes > account->peak_bytes) {
+            account->peak_bytes = account->bytes;
+        }
+        account->allocations += allocation ? 1u : 0u;
+        account->frees += release ? 1u : 0u;
+    }
+
+    if (allocation) {
+        __atomic_fetch_add(&g_allocations, 1u, __ATOMIC_RELAXED);
+    }
+    if (release) {
+        __atomic_fetch_add(&g_frees, 1u, __ATOMIC_RELAXED);
+    }
+
+    size_t bytes = __atomic_add_fetch(&g_bytes, grow, __ATOMIC_RELAXED);
+    bytes = __atomic_sub_fetch(&g_bytes, shrink, __ATOMIC_RELAXED);
+    size_t peak = __atomic_load_n(&g_peak_bytes, __ATOMIC_RELAXED);
+    while (bytes > peak &&
+           !__atomic_compare_exchange_n(&g_peak_bytes, &peak, bytes, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+/**
+ * @brief 할당 (malloc과 같은 정렬)
+ */
+void* Mem_Alloc(Mem_Account_T* account, size_t bytes)
+{
+    return Mem_AlignedAlloc(account, MEM_HEADER_SIZE, bytes);
+}
+
+/**
+ * @brief 0으로 초기화된 배열 할당
+ */
+void* Mem_Calloc(Mem_Account_T* account, size_t count, size_t size)
+{
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+
+    void* data = Mem_Alloc(account, count * size);
+    if (data != NULL) {
+        memset(data, 0, count * size);
+    }
+    return data;
+}
+
+/**
+ * @brief 정렬된 할당
+ */
+void* Mem_AlignedAlloc(Mem_Account_T* account, size_t alignment, size_t bytes)
+{
+    if (alignment < MEM_HEADER_SIZE || (alignment & (alignment - 1)) != 0 ||
+        bytes > SIZE_MAX - alignment - MEM_HEADER_SIZE) {
+        return NULL;
+    }
+
+    Mem_CheckSealed(account, bytes);
+
+    /* malloc 정렬(MEM_HEADER_SIZE 이상)이면 헤더만큼만, 그보다 크면 정렬 여유를 더 할당 */
+    size_t extra = (alignment == MEM_HEADER_SIZE) ? MEM_HEADER_SIZE : alignment + MEM_HEADER_SIZE;
+    unsigned char* raw = (unsigned char*)malloc(bytes + extra);
+    if (raw == NULL) {
+        return NULL;
+    }
+
+    uintptr_t start = (uintptr_t)raw + MEM_HEADER_SIZE;
+    unsigned char* data = (unsigned char*)((start + alignment - 1) & ~(uintptr_t)(alignment - 1));
+
+    Mem_Header_T* header = Mem_GetHeader(data);
+    header->info.size = bytes;
+    header->info.offset = (size_t)(data - raw);
+
+    Mem_Charge(account, bytes, 0, true, false);
+    return data;
+}
+
+/**
+ * @brief 크기 변경
+ */
+void* Mem_Realloc(Mem_Account_T* account, void* data, size_t bytes)
+{
+    if (data == NULL) {
+        return Mem_Alloc(account, bytes);
+    }
+
+    Mem_Header_T* header = Mem_GetHeader(data);
+    size_t old_size = header->info.size;
+    if (header->info.offset != MEM_HEADER_SIZE || bytes > SIZE_MAX - MEM_HEADER_SIZE) {
+        return NULL;  /* 정렬 할당은 크기 변경 불가 */
+    }
+
+    boolean_T grow = (boolean_T)(bytes > old_size);
+    if (grow) {
+        Mem_CheckSealed(account, bytes - old_size);
+    }
+
+    unsigned char* raw = (unsigned char*)realloc((unsigned char*)header, bytes + MEM_HEADER_SIZE);
+    if (raw == NULL) {
+        return NULL;
+    }
+
+    header = (Mem_Header_T*)raw;
+    header->info.size = bytes;
+    Mem_Charge(account, grow ? bytes - old_size : 0, grow ? 0 : old_size - bytes, grow, false);
+    return raw + MEM_HEADER_SIZE;
+}
+
+/**
+ * @brief 해제
+ */
+void Mem_Free(Mem_Account_T* account, void* data)
+{
+    if (data == NULL) {
+        return;
+    }
+
+    Mem_Header_T* header = Mem_GetHeader(data);
+    size_t size = header->info.size;
+    unsigned char* raw = (unsigned char*)data - header->info.offset;
+
+    Mem_Charge(account, 0, size, false, true);
+    free(raw);
+}
+
+/**
+ * @brief 계정 초기화
+ */
+void Mem_Reset(Mem_Account_T* account)
+{
+    if (account == NULL) {
+        return;
+    }
+
+    memset(account, 0, sizeof(Mem_Account_T));
+}
+
+/**
+ * @brief 계정 봉인
+ */
+void Mem_Seal(Mem_Account_T* account)
+{
+    if (account == NULL) {
+        return;
+    }
+
+    account->sealed = true;
+}
+
+/**
+ * @brief 계정 합산
+ */
+void Mem_Accumulate(Mem_Account_T* total, const Mem_Account_T* part)
+{
+    if (total == NULL || part == NULL) {
+        return;
+    }
+
+    boolean_T first = (boolean_T)(total->allocations == 0 && total->frees == 0 && total->bytes == 0);
+    total->bytes += part->bytes;
+    total->peak_bytes += part->peak_bytes;
+    total->allocations += part->allocations;
+    total->frees += part->frees;
+    total->violations += part->violations;
+    total->sealed = (boolean_T)(first ? part->sealed : (total->sealed && part->sealed));
+}
+
+/**
+ * @brief 프로세스 전체 집계
+ */
+void Mem_GetGlobal(Mem_Account_T* global)
+{
+    if (global == NULL) {
+        return;
+    }
+
+    global->bytes = __atomic_load_n(&g_bytes, __ATOMIC_RELAXED);
+    global->peak_bytes = __atomic_load_n(&g_peak_bytes, __ATOMIC_RELAXED);
+    global->allocations = __atomic_load_n(&g_allocations, __ATOMIC_RELAXED);
+    global->frees = __atomic_load_n(&g_frees, __ATOMIC_RELAXED);
+    global->violations = __atomic_load_n(&g_violations, __ATOMIC_RELAXED);
+    global->sealed = (boolean_T)(__atomic_load_n(&g_strict, __ATOMIC_RELAXED) != 0);
+}
+
+/**
+ * @brief 엄격 모드 설정
+ */
+void Mem_SetStrict(boolean_T strict)
+{
+    __atomic_store_n(&g_strict, strict ? 1u : 0u, __ATOMIC_RELAXED);
+}
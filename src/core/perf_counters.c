@@ -0,0 +1,327 @@
+/*
+ * perf_counters.c
+ *
+ * 하드웨어 성능 카운터 모듈 구현
+ */
+
+#define _GNU_SOURCE
+
+#include "perf_counters.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define PERF_HAVE_EVENTS  1
+#endif
+
+/* 상수 정의 */
+#define PERF_DESCRIBE_SIZE         128
+
+static char g_describe[PERF_DESCRIBE_SIZE];
+
+#ifdef PERF_HAVE_EVENTS
+
+/* 이벤트별 perf_event_attr 형식 / 설정 */
+static const struct {
+    uint32_t type;
+    uint64_t config;
+} g_events[PERF_EVENTS] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                          (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+};
+
+static int PerfEventOpen(struct perf_event_attr* attr)
+{
+    /* 호출 스레드 (pid 0), 모든 CPU (-1), 그룹 없음 */
+    return (int)syscall(__NR_perf_event_open, attr, 0, -1, -1, 0);
+}
+
+#endif /* PERF_HAVE_EVENTS */
+
+/**
+ * @brief 벤치마크 도구에서 카운터를 쓸지 여부
+ */
+boolean_T Perf_Requested(void)
+{
+    const char* value = getenv(PERF_ENV_NAME);
+    return (boolean_T)(value != NULL && strcmp(value, "1") == 0);
+}
+
+/**
+ * @brief 카운터 열기
+ */
+boolean_T Perf_Open(Perf_Counters_T* counters)
+{
+    if (counters == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        counters->fd[i] = -1;
+    }
+    counters->opened = 0;
+    counters->error = 0;
+
+#ifdef PERF_HAVE_EVENTS
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = g_events[i].type;
+        attr.config = g_events[i].config;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        int fd = PerfEventOpen(&attr);
+        if (fd >= 0) {
+            counters->fd[i] = (int32_T)fd;
+            counters->opened++;
+        } else if (counters->error == 0) {
+            counters->error = (int32_T)errno;
+        }
+    }
+#else
+    counters->error = ENOSYS;
+#endif
+
+    return (boolean_T)(counters->opened > 0);
+}
+
+/**
+ * @brief 카운터 닫기
+ */
+void Perf_Close(Perf_Counters_T* counters)
+{
+    /* opened 0이면 열지 않은 (0으로 초기화된) 구조체일 수 있으므로 fd를 건드리지 않음 */
+    if (counters == NULL || counters->opened == 0) {
+        return;
+    }
+
+#ifdef PERF_HAVE_EVENTS
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        if (counters->fd[i] >= 0) {
+            close(counters->fd[i]);
+        }
+    }
+#endif
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        counters->fd[i] = -1;
+    }
+    counters->opened = 0;
+}
+
+/**
+ * @brief 구간 시작
+ */
+void Perf_Start(Perf_Counters_T* counters)
+{
+    if (counters == NULL || counters->opened == 0) {
+        return;
+    }
+
+#ifdef PERF_HAVE_EVENTS
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        if (counters->fd[i] >= 0) {
+            ioctl(counters->fd[i], PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+    /* 활성화는 마지막에 몰아서 (초기화 시스템 호출이 구간에 섞이지 않도록) */
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        if (counters->fd[i] >= 0) {
+            ioctl(counters->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+/**
+ * @brief 구간 끝
+ */
+void Perf_Stop(Perf_Counters_T* counters, Perf_Sample_T* sample)
+{
+    if (counters == NULL || counters->opened == 0) {
+        return;
+    }
+
+#ifdef PERF_HAVE_EVENTS
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        if (counters->fd[i] >= 0) {
+            ioctl(counters->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    if (sample == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        uint64_t data[3];          /* 값, 활성 시간, 실제 측정 시간 */
+        if (counters->fd[i] < 0 || read(counters->fd[i], data, sizeof(data)) != (ssize_t)sizeof(data)) {
+            continue;
+        }
+        if (data[2] == 0) {
+            continue;              /* 한 번도 스케줄되지 않음 (다른 이벤트에 밀림) */
+        }
+
+        real_T ratio = (data[1] > 0) ? (real_T)data[2] / (real_T)data[1] : 1.0;
+        sample->value[i] += (real_T)data[0] / ratio;
+        sample->valid[i] = true;
+        if (ratio < sample->running_ratio) {
+            sample->running_ratio = ratio;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief 결과 초기화
+ */
+void Perf_Reset(Perf_Sample_T* sample)
+{
+    if (sample == NULL) {
+        return;
+    }
+
+    memset(sample, 0, sizeof(Perf_Sample_T));
+    sample->running_ratio = 1.0;
+}
+
+/**
+ * @brief 카운터 상태 설명
+ */
+const char* Perf_Describe(const Perf_Counters_T* counters)
+{
+    if (counters == NULL) {
+        return "";
+    }
+
+    const char* reason;
+    switch (counters->error) {
+        case 0:
+            reason = "";
+            break;
+        case EACCES:
+        case EPERM:
+            reason = "권한 없음 (perf_event_paranoid / seccomp)";
+            break;
+        case ENOENT:
+        case ENODEV:
+        case EOPNOTSUPP:
+            reason = "하드웨어 이벤트 미지원 (가상 머신 / PMU 없음)";
+            break;
+        case ENOSYS:
+            reason = "perf_event_open 미지원";
+            break;
+        default:
+            reason = strerror(counters->error);
+            break;
+    }
+
+    if (counters->opened == 0) {
+        snprintf(g_describe, sizeof(g_describe), "사용 불가: %s", reason);
+    } else if (counters->opened < PERF_EVENTS) {
+        snprintf(g_describe, sizeof(g_describe), "%u/%d 이벤트 (나머지: %s)",
+                 (unsigned)counters->opened, PERF_EVENTS, reason);
+    } else {
+        snprintf(g_describe, sizeof(g_describe), "%d/%d 이벤트 (사용자 공간)", PERF_EVENTS, PERF_EVENTS);
+    }
+    return g_describe;
+}
+
+/**
+ * @brief IPC (명령어 / 사이클)
+ */
+real_T Perf_GetIPC(const Perf_Sample_T* sample)
+{
+    if (sample == NULL || !sample->valid[PERF_CYCLES] || !sample->valid[PERF_INSTRUCTIONS] ||
+        sample->value[PERF_CYCLES] <= 0.0) {
+        return -1.0;
+    }
+    return sample->value[PERF_INSTRUCTIONS] / sample->value[PERF_CYCLES];
+}
+
+/**
+ * @brief 단위당 이벤트 수
+ */
+real_T Perf_GetPerUnit(const Perf_Sample_T* sample, Perf_Event_T event, real_T units)
+{
+    if (sample == NULL || event >= PERF_EVENTS || !sample->valid[event] || !(units > 0.0)) {
+        return -1.0;
+    }
+    return sample->value[event] / units;
+}
+
+static void PrintValue(FILE* out, const char* name, real_T value, const char* format)
+{
+    fprintf(out, "%s ", name);
+    if (value < 0.0) {
+        fprintf(out, "n/a");
+    } else {
+        fprintf(out, format, value);
+    }
+}
+
+/**
+ * @brief 한 줄 요약 출력
+ */
+void Perf_PrintSummary(FILE* out, const Perf_Sample_T* sample, real_T units, const char* unit)
+{
+    if (out == NULL || sample == NULL) {
+        return;
+    }
+
+    PrintValue(out, "IPC", Perf_GetIPC(sample), "%.2f");
+    fprintf(out, ", %s당 ", (unit != NULL) ? unit : "단위");
+    PrintValue(out, "명령어", Perf_GetPerUnit(sample, PERF_INSTRUCTIONS, units), "%.1f");
+    fprintf(out, ", ");
+    PrintValue(out, "L1D 미스", Perf_GetPerUnit(sample, PERF_L1D_MISSES, units), "%.3f");
+    fprintf(out, ", ");
+    PrintValue(out, "LLC 미스", Perf_GetPerUnit(sample, PERF_LLC_MISSES, units), "%.4f");
+    fprintf(out, ", ");
+    PrintValue(out, "분기 예측 실패", Perf_GetPerUnit(sample, PERF_BRANCH_MISSES, units), "%.3f");
+    if (sample->running_ratio < 1.0) {
+        fprintf(out, " (다중화 %.0f%%)", sample->running_ratio * 100.0);
+    }
+    fprintf(out, "\n");
+}
+
+static void PrintJsonValue(FILE* out, const char* name, real_T value, boolean_T last)
+{
+    if (value < 0.0) {
+        fprintf(out, "\"%s\": null%s", name, last ? "" : ", ");
+    } else {
+        fprintf(out, "\"%s\": %.6g%s", name, value, last ? "" : ", ");
+    }
+}
+
+/**
+ * @brief JSON 객체 출력
+ */
+void Perf_PrintJson(FILE* out, const Perf_Sample_T* sample, real_T units)
+{
+    if (out == NULL || sample == NULL) {
+        return;
+    }
+
+    fprintf(out, "{");
+    PrintJsonValue(out, "ipc", Perf_GetIPC(sample), false);
+    PrintJsonValue(out, "cycles", Perf_GetPerUnit(sample, PERF_CYCLES, units), false);
+    PrintJsonValue(out, "instructions", Perf_GetPerUnit(sample, PERF_INSTRUCTIONS, units), false);
+    PrintJsonValue(out, "l1d_misses", Perf_GetPerUnit(sample, PERF_L1D_MISSES, units), false);
+    PrintJsonValue(out, "llc_misses", Perf_GetPerUnit(sample, PERF_LLC_MISSES, units), false);
+    PrintJsonValue(out, "branch_misses", Perf_GetPerUnit(sample, PERF_BRANCH_MISSES, units), false);
+    PrintJsonValue(out, "running_ratio", sample->running_ratio, true);
+    fprintf(out, "}");
+}
@@ -6,6 +6,10 @@
  */
 
 #include "rls.h"
+#include "matrix_ops.h"
+#include "cholesky.h"
+#include "mem_account.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
@@ -39,16 +43,16 @@ boolean_T RLS_Initialize(RLS_T* rls, const RLS_Params_T* params, uint32_T num_pa
     uint32_T matrix_size = num_parameters * num_parameters;
     uint32_T vector_size = num_parameters;
     
-    rls->internal.P = (real_T*)malloc(matrix_size * sizeof(real_T));
-    rls->internal.theta = (real_T*)malloc(vector_size * sizeof(real_T));
-    rls->internal.phi = (real_T*)malloc(vector_size * sizeof(real_T));
-    rls->internal.K = (real_T*)malloc(vector_size * sizeof(real_T));
-    rls->internal.P_phi = (real_T*)malloc(vector_size * sizeof(real_T));
-    rls->internal.phi_transpose = (real_T*)malloc(vector_size * sizeof(real_T));
+    Mem_Reset(&rls->internal.memory);
+    rls->internal.P = (real_T*)Mem_Alloc(&rls->internal.memory, matrix_size * sizeof(real_T));
+    rls->internal.theta = (real_T*)Mem_Alloc(&rls->internal.memory, vector_size * sizeof(real_T));
+    rls->internal.phi = (real_T*)Mem_Alloc(&rls->internal.memory, vector_size * sizeof(real_T));
+    rls->internal.K = (real_T*)Mem_Alloc(&rls->internal.memory, vector_size * sizeof(real_T));
+    rls->internal.P_phi = (real_T*)Mem_Alloc(&rls->internal.memory, vector_size * sizeof(real_T));
     
     /* 메모리 할당 실패 확인 */
     if (!rls->internal.P || !rls->internal.theta || !rls->internal.phi ||
-        !rls->internal.K || !rls->internal.P_phi || !rls->internal.phi_transpose) {
+        !rls->internal.K || !rls->internal.P_phi) {
         RLS_Cleanup(rls);
         return false;
     }
@@ -69,6 +73,13 @@ boolean_T RLS_Initialize(RLS_T* rls, const RLS_Params_T* params, uint32_T num_pa
     /* 기타 변수 초기화 */
     rls->internal.innovation = 0.0;
     rls->internal.innovation_covariance = 1.0;
+    rls->internal.update_count = 0;
+    rls->internal.skip_count = 0;
+    rls->internal.low_excitation_run = 0;
+    
+    /* 여기 기반 생략은 RLS_SetExcitation 호출 전까지 비활성 */
+    memset(&rls->excitation, 0, sizeof(RLS_Excitation_T));
+    Mem_Seal(&rls->internal.memory);
     rls->internal.initialized = true;
     
     return true;
@@ -85,42 +96,64 @@ void RLS_Cleanup(RLS_T* rls)
     
     /* 메모리 해제 */
     if (rls->internal.P) {
-        free(rls->internal.P);
+        Mem_Free(&rls->internal.memory, rls->internal.P);
         rls->internal.P = NULL;
     }
     if (rls->internal.theta) {
-        free(rls->internal.theta);
+        Mem_Free(&rls->internal.memory, rls->internal.theta);
         rls->internal.theta = NULL;
     }
     if (rls->internal.phi) {
-        free(rls->internal.phi);
+        Mem_Free(&rls->internal.memory, rls->internal.phi);
         rls->internal.phi = NULL;
     }
     if (rls->internal.K) {
-        free(rls->internal.K);
+        Mem_Free(&rls->internal.memory, rls->internal.K);
         rls->internal.K = NULL;
     }
     if (rls->internal.P_phi) {
-        free(rls->internal.P_phi);
+        Mem_Free(&rls->internal.memory, rls->internal.P_phi);
         rls->internal.P_phi = NULL;
     }
-    if (rls->internal.phi_transpose) {
-        free(rls->internal.phi_transpose);
-        rls->internal.phi_transpose = NULL;
-    }
     
     rls->internal.initialized = false;
 }
 
 /**
- * @brief RLS 파라미터 추정 실행
+ * @brief 여기 기반 업데이트 생략 설정
  */
-void RLS_Update(RLS_T* rls, const real_T* phi, real_T y)
+void RLS_SetExcitation(RLS_T* rls, const RLS_Excitation_T* config)
 {
-    if (!rls->internal.initialized || phi == NULL) {
+    if (rls == NULL || config == NULL) {
         return;
     }
     
+    rls->excitation = *config;
+    rls->internal.low_excitation_run = 0;
+}
+
+/**
+ * @brief 업데이트 수행 / 생략 횟수 반환
+ */
+void RLS_GetUpdateCounts(const RLS_T* rls, uint32_T* updated, uint32_T* skipped)
+{
+    if (rls == NULL) {
+        return;
+    }
+    
+    if (updated != NULL) {
+        *updated = rls->internal.update_count;
+    }
+    if (skipped != NULL) {
+        *skipped = rls->internal.skip_count;
+    }
+}
+
+/**
+ * @brief P * phi를 internal.P_phi에 계산하고 phi^T * P * phi 반환
+ */
+static real_T RLS_Information(RLS_T* rls, const real_T* phi)
+{
     uint32_T n = rls->internal.num_parameters;
     
     /* 회귀 벡터 복사 */
@@ -134,12 +167,24 @@ void RLS_Update(RLS_T* rls, const real_T* phi, real_T y)
         }
     }
     
-    /* 혁신 공분산 계산: S = phi^T * P * phi + lambda */
-    rls->internal.innovation_covariance = 0.0;
+    /* 이 회귀 벡터 방향의 불확실성: phi^T * P * phi */
+    real_T information = 0.0;
     for (uint32_T i = 0; i < n; i++) {
-        rls->internal.innovation_covariance += phi[i] * rls->internal.P_phi[i];
+        information += phi[i] * rls->internal.P_phi[i];
     }
-    rls->internal.innovation_covariance += rls->params.lambda;
+    return information;
+}
+
+/**
+ * @brief 샘플 하나 업데이트 (여기 판정 / 횟수 집계 없음)
+ * RLS_Information으로 계산한 P_phi와 information 사용
+ */
+static void RLS_ApplyUpdate(RLS_T* rls, const real_T* phi, real_T y, real_T information)
+{
+    uint32_T n = rls->internal.num_parameters;
+    
+    /* 혁신 공분산 계산: S = phi^T * P * phi + lambda */
+    rls->internal.innovation_covariance = information + rls->params.lambda;
     
     /* 칼만 게인 계산: K = P * phi / S */
     if (rls->internal.innovation_covariance > 1e-10) {
@@ -165,42 +210,264 @@ void RLS_Update(RLS_T* rls, const real_T* phi, real_T y)
         rls->internal.theta[i] += rls->internal.K[i] * rls->internal.innovation;
     }
     
-    /* 공분산 업데이트: P = (P - K * phi^T * P) / lambda */
-    /* 먼저 K * phi^T 계산 */
+    /* 공분산 업데이트: P = (P - K * phi^T * P) / lambda
+     * P가 대칭이므로 K * phi^T * P = K * (P * phi)^T = (P * phi)(P * phi)^T / S
+     * 이미 계산한 P_phi를 재사용하는 대칭 랭크-1 업데이트로 O(n^2)에 처리 */
+    real_T alpha = (rls->internal.innovation_covariance > 1e-10) ?
+                   -1.0 / rls->internal.innovation_covariance : 0.0;
+    Matrix_SymRank1Update(rls->internal.P, rls->internal.P_phi, alpha,
+                          1.0 / rls->params.lambda, n);
+    
+    /* 공분산 행렬의 대각선 요소가 너무 작아지지 않도록 제한 */
     for (uint32_T i = 0; i < n; i++) {
-        for (uint32_T j = 0; j < n; j++) {
-            rls->internal.phi_transpose[i * n + j] = rls->internal.K[i] * phi[j];
+        if (rls->internal.P[i * n + i] < RLS_MIN_COVARIANCE) {
+            rls->internal.P[i * n + i] = RLS_MIN_COVARIANCE;
+        }
+    }
+}
+
+/**
+ * @brief RLS 파라미터 추정 실행
+ */
+void RLS_Update(RLS_T* rls, const real_T* phi, real_T y)
+{
+    if (!rls->internal.initialized || phi == NULL) {
+        return;
+    }
+    
+    real_T information = RLS_Information(rls, phi);
+    
+    /* 여기 판정: 불확실성이 작으면 새 정보가 없으므로 생략 (망각도 적용하지 않음) */
+    if (rls->excitation.enable && information < rls->excitation.min_information) {
+        rls->internal.low_excitation_run++;
+        if (rls->excitation.decimation == 0 ||
+            rls->internal.low_excitation_run < rls->excitation.decimation) {
+            rls->internal.skip_count++;
+            return;
         }
     }
+    rls->internal.low_excitation_run = 0;
+    rls->internal.update_count++;
     
-    /* P - K * phi^T * P 계산 */
-    real_T* P_new = (real_T*)malloc(n * n * sizeof(real_T));
-    if (P_new) {
-        for (uint32_T i = 0; i < n; i++) {
-            for (uint32_T j = 0; j < n; j++) {
-                P_new[i * n + j] = rls->internal.P[i * n + j];
-                for (uint32_T k = 0; k < n; k++) {
-                    P_new[i * n + j] -= rls->internal.phi_transpose[i * n + k] * rls->internal.P[k * n + j];
-                }
+    RLS_ApplyUpdate(rls, phi, y, information);
+}
+
+/**
+ * @brief 샘플 단위 업데이트 반복 (블록 경로의 대체 처리, 여기 판정 없음)
+ */
+static void RLS_UpdateSequential(RLS_T* rls, const real_T* Phi, const real_T* y, uint32_T k)
+{
+    uint32_T n = rls->internal.num_parameters;
+    
+    for (uint32_T i = 0; i < k; i++) {
+        const real_T* phi = &Phi[i * n];
+        RLS_ApplyUpdate(rls, phi, y[i], RLS_Information(rls, phi));
+    }
+}
+
+/**
+ * @brief 공분산 대각 하한 적용
+ */
+static void RLS_ClampCovariance(RLS_T* rls)
+{
+    uint32_T n = rls->internal.num_parameters;
+    
+    for (uint32_T i = 0; i < n; i++) {
+        if (rls->internal.P[i * n + i] < RLS_MIN_COVARIANCE) {
+            rls->internal.P[i * n + i] = RLS_MIN_COVARIANCE;
+        }
+    }
+}
+
+/**
+ * @brief RLS 블록 업데이트, 정보 형태 (k > n일 때 n x n 풀이)
+ *   P_new^-1 = lambda^k * P^-1 + sum_i lambda^(k-i) * phi_i * phi_i^T
+ *   P_new^-1 * theta_new = lambda^k * P^-1 * theta + sum_i lambda^(k-i) * phi_i * y_i
+ * @return 성공 여부 (P 또는 정보 행렬이 양의 정부호가 아니면 false, 상태 변경 없음)
+ */
+static boolean_T RLS_UpdateBlockInformation(RLS_T* rls, const real_T* Phi, const real_T* y, uint32_T k)
+{
+    uint32_T n = rls->internal.num_parameters;
+    real_T lambda = rls->params.lambda;
+    
+    real_T L[RLS_BLOCK_MAX_PARAMETERS * RLS_BLOCK_MAX_PARAMETERS];
+    real_T A[RLS_BLOCK_MAX_PARAMETERS * RLS_BLOCK_MAX_PARAMETERS];
+    real_T b[RLS_BLOCK_MAX_PARAMETERS];
+    
+    /* 사전 정보: A = P^-1, b = P^-1 * theta */
+    memcpy(L, rls->internal.P, n * n * sizeof(real_T));
+    if (!Cholesky_Factor(L, n)) {
+        return false;
+    }
+    Cholesky_Inverse(L, A, n);
+    
+    for (uint32_T r = 0; r < n; r++) {
+        b[r] = 0.0;
+        for (uint32_T c = 0; c < n; c++) {
+            b[r] += A[r * n + c] * rls->internal.theta[c];
+        }
+    }
+    
+    /* 호너 형태로 누적: A = lambda * A + phi * phi^T, b = lambda * b + phi * y (상삼각) */
+    for (uint32_T i = 0; i < k; i++) {
+        const real_T* phi = &Phi[i * n];
+        
+        for (uint32_T r = 0; r < n; r++) {
+            real_T* row = &A[r * n];
+            for (uint32_T c = r; c < n; c++) {
+                row[c] = lambda * row[c] + phi[r] * phi[c];
             }
+            b[r] = lambda * b[r] + phi[r] * y[i];
+        }
+    }
+    for (uint32_T r = 0; r < n; r++) {
+        for (uint32_T c = 0; c < r; c++) {
+            A[r * n + c] = A[c * n + r];
         }
+    }
+    
+    if (!Cholesky_Factor(A, n)) {
+        return false;
+    }
+    
+    /* 마지막 샘플의 사전 혁신 (RLS_Update와 같은 의미는 아니며 참고용) */
+    const real_T* phi_last = &Phi[(k - 1) * n];
+    rls->internal.innovation = y[k - 1];
+    for (uint32_T c = 0; c < n; c++) {
+        rls->internal.innovation -= phi_last[c] * rls->internal.theta[c];
+    }
+    
+    Cholesky_Solve(A, b, n);
+    Cholesky_Inverse(A, rls->internal.P, n);
+    memcpy(rls->internal.theta, b, n * sizeof(real_T));
+    
+    RLS_ClampCovariance(rls);
+    return true;
+}
+
+/**
+ * @brief RLS 블록 업데이트, 행렬 역변환 보조정리 (k x k 풀이)
+ */
+static void RLS_UpdateBlockChunk(RLS_T* rls, const real_T* Phi, const real_T* y, uint32_T k)
+{
+    uint32_T n = rls->internal.num_parameters;
+    real_T* P = rls->internal.P;
+    real_T* theta = rls->internal.theta;
+    real_T lambda = rls->params.lambda;
+    
+    real_T U[RLS_BLOCK_SIZE * RLS_BLOCK_MAX_PARAMETERS];    /* Phi * P (k x n) */
+    real_T G[RLS_BLOCK_SIZE * RLS_BLOCK_MAX_PARAMETERS];    /* S^-1 * Phi * P = G^T (k x n) */
+    real_T S[RLS_BLOCK_SIZE * RLS_BLOCK_SIZE];              /* 혁신 공분산 (k x k) */
+    real_T e[RLS_BLOCK_SIZE];                               /* 사전 혁신 */
+    
+    /* U = Phi * P (P 대칭), e = y - Phi * theta */
+    for (uint32_T i = 0; i < k; i++) {
+        const real_T* phi = &Phi[i * n];
+        real_T* u = &U[i * n];
         
-        /* lambda로 나누기 */
-        for (uint32_T i = 0; i < n * n; i++) {
-            P_new[i] /= rls->params.lambda;
+        for (uint32_T c = 0; c < n; c++) {
+            u[c] = 0.0;
+        }
+        for (uint32_T r = 0; r < n; r++) {
+            const real_T* P_row = &P[r * n];
+            real_T phi_r = phi[r];
+            for (uint32_T c = 0; c < n; c++) {
+                u[c] += phi_r * P_row[c];
+            }
         }
         
-        /* 공분산 행렬 업데이트 */
-        memcpy(rls->internal.P, P_new, n * n * sizeof(real_T));
-        free(P_new);
+        e[i] = y[i];
+        for (uint32_T c = 0; c < n; c++) {
+            e[i] -= phi[c] * theta[c];
+        }
     }
     
-    /* 공분산 행렬의 대각선 요소가 너무 작아지지 않도록 제한 */
-    for (uint32_T i = 0; i < n; i++) {
-        if (rls->internal.P[i * n + i] < RLS_MIN_COVARIANCE) {
-            rls->internal.P[i * n + i] = RLS_MIN_COVARIANCE;
+    /* S = Phi * P * Phi^T + diag(lambda^1 .. lambda^k) (하삼각만 사용) */
+    real_T weight = 1.0;
+    for (uint32_T i = 0; i < k; i++) {
+        const real_T* u = &U[i * n];
+        
+        for (uint32_T j = 0; j <= i; j++) {
+            const real_T* phi = &Phi[j * n];
+            real_T sum = 0.0;
+            for (uint32_T c = 0; c < n; c++) {
+                sum += u[c] * phi[c];
+            }
+            S[i * k + j] = sum;
+            S[j * k + i] = sum;
+        }
+        weight *= lambda;
+        S[i * k + i] += weight;
+    }
+    
+    /* G^T = S^-1 * U (다중 우변 Cholesky 풀이) */
+    if (!Cholesky_Factor(S, k)) {
+        /* 수치적으로 분해가 불가능하면 샘플 단위 업데이트로 처리 */
+        RLS_UpdateSequential(rls, Phi, y, k);
+        return;
+    }
+    memcpy(G, U, k * n * sizeof(real_T));
+    Cholesky_SolveMatrix(S, G, k, n);
+    
+    /* theta += G * e */
+    for (uint32_T i = 0; i < k; i++) {
+        const real_T* g = &G[i * n];
+        for (uint32_T c = 0; c < n; c++) {
+            theta[c] += g[c] * e[i];
         }
     }
+    
+    /* P = (P - G * U) / lambda^k (랭크-k 업데이트, 상삼각 계산 후 대칭 복사) */
+    real_T scale = 1.0 / weight;
+    for (uint32_T r = 0; r < n; r++) {
+        for (uint32_T c = r; c < n; c++) {
+            real_T sum = 0.0;
+            for (uint32_T i = 0; i < k; i++) {
+                sum += G[i * n + r] * U[i * n + c];
+            }
+            P[r * n + c] = (P[r * n + c] - sum) * scale;
+            P[c * n + r] = P[r * n + c];
+        }
+    }
+    
+    RLS_ClampCovariance(rls);
+    rls->internal.innovation = e[k - 1];
+}
+
+/**
+ * @brief RLS 블록 업데이트 (샘플 k개를 한 번에 처리)
+ */
+void RLS_UpdateBlock(RLS_T* rls, const real_T* Phi, const real_T* y, uint32_T k)
+{
+    if (rls == NULL || !rls->internal.initialized || Phi == NULL || y == NULL) {
+        return;
+    }
+    
+    uint32_T n = rls->internal.num_parameters;
+    
+    /* 여기 판정 없이 모든 샘플을 적용하므로 전부 수행한 업데이트로 집계 */
+    rls->internal.update_count += k;
+    rls->internal.low_excitation_run = 0;
+    
+    if (n > RLS_BLOCK_MAX_PARAMETERS) {
+        RLS_UpdateSequential(rls, Phi, y, k);
+        return;
+    }
+    
+    while (k > 0) {
+        uint32_T block = (k < RLS_BLOCK_SIZE) ? k : RLS_BLOCK_SIZE;
+        
+        /* 샘플 수가 파라미터 수보다 많으면 n x n 정보 형태가 k x k 풀이보다 저렴 */
+        if (block == 1) {
+            RLS_UpdateSequential(rls, Phi, y, 1);
+        } else if (block <= n || !RLS_UpdateBlockInformation(rls, Phi, y, block)) {
+            RLS_UpdateBlockChunk(rls, Phi, y, block);
+        }
+        
+        Phi += block * n;
+        y += block;
+        k -= block;
+    }
 }
 
 /**
@@ -232,12 +499,25 @@ real_T RLS_GetParameter(const RLS_T* rls, uint32_T index)
  */
 void RLS_PrintStatus(const RLS_T* rls)
 {
-    if (!rls->internal.initialized) {
+    if (rls == NULL || !rls->internal.initialized) {
         return;
     }
     
-    /* 현재는 빈 함수로 구현 - 필요시 printf 등으로 확장 */
-    (void)rls; /* 컴파일러 경고 방지 */
+    const RLS_Internal_T* in = &rls->internal;
+    uint32_T n = in->num_parameters;
+    uint32_T total = in->update_count + in->skip_count;
+    
+    printf("RLS theta:");
+    for (uint32_T i = 0; i < n; i++) {
+        printf(" %.6f", in->theta[i]);
+    }
+    printf("\nRLS diag(P):");
+    for (uint32_T i = 0; i < n; i++) {
+        printf(" %.3e", in->P[i * n + i]);
+    }
+    printf("\nRLS 혁신: %.3e, 망각 인자: %.3f\n", in->innovation, rls->params.lambda);
+    printf("RLS 업데이트/생략: %u/%u (생략 비율 %.1f%%)\n", (unsigned)in->update_count,
+           (unsigned)in->skip_count, (total > 0) ? 100.0 * in->skip_count / (real_T)total : 0.0);
 }
 
 /**
@@ -267,4 +547,7 @@ void RLS_Reset(RLS_T* rls)
     /* 기타 변수 초기화 */
     rls->internal.innovation = 0.0;
     rls->internal.innovation_covariance = 1.0;
+    rls->internal.update_count = 0;
+    rls->internal.skip_count = 0;
+    rls->internal.low_excitation_run = 0;
 }
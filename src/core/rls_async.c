@@ -0,0 +1,291 @@
+/*
+ * rls_async.c
+ *
+ * 비동기 RLS 모듈 구현
+ * 공유 변수는 GCC __atomic 내장 함수로 접근 (C99에서 사용 가능)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "rls_async.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+    #include <pthread.h>
+    #include <sched.h>
+    #include <time.h>
+    #define RLS_ASYNC_HAVE_THREADS  1
+#endif
+
+/* 상수 정의 */
+#define RLS_ASYNC_CACHE_LINE       64      /* 캐시 라인 크기 (거짓 공유 방지) */
+#define RLS_ASYNC_QUEUE_MASK       (RLS_ASYNC_QUEUE_SIZE - 1)
+#define RLS_ASYNC_SPIN_LIMIT       64      /* 잠들기 전 양보 횟수 */
+#define RLS_ASYNC_IDLE_SLEEP_NS    50000   /* 유휴 시 대기 시간 (50us) */
+
+#ifdef _MSC_VER
+    #define RLS_ASYNC_ALIGN  __declspec(align(RLS_ASYNC_CACHE_LINE))
+#else
+    #define RLS_ASYNC_ALIGN  __attribute__((aligned(RLS_ASYNC_CACHE_LINE)))
+#endif
+
+/* 링 버퍼 샘플 */
+typedef struct {
+    real_T phi[RLS_ASYNC_MAX_PARAMETERS];
+    real_T y;
+} RLS_Async_Sample_T;
+
+/*
+ * 비동기 RLS 구조체
+ * 생산자 / 소비자 / 게시 영역을 서로 다른 캐시 라인에 배치
+ */
+struct RLS_Async_T {
+    /* 생산자 (스텝 스레드) 전용 */
+    RLS_ASYNC_ALIGN uint32_T head;         /* 다음에 쓸 위치 (게시 카운터) */
+    uint32_T dropped;                      /* 링이 가득 차 버려진 샘플 수 */
+
+    /* 소비자 (작업 스레드) 전용 */
+    RLS_ASYNC_ALIGN uint32_T tail;         /* 다음에 읽을 위치 */
+
+    /* seqlock 게시 영역 (작업 스레드 쓰기, 스텝 스레드 읽기) */
+    RLS_ASYNC_ALIGN uint32_T sequence;     /* 홀수이면 쓰기 중 */
+    uint32_T published;                    /* 게시된 theta에 반영된 샘플 수 */
+    real_T theta[RLS_ASYNC_MAX_PARAMETERS];
+
+    /* 제어 */
+    RLS_ASYNC_ALIGN uint32_T running;      /* 작업 스레드 실행 플래그 */
+    uint32_T num_parameters;
+    Mem_Account_T memory;                  /* 구조체 자체의 할당 계정 */
+    RLS_T rls;                             /* 작업 스레드가 소유하는 RLS */
+#ifdef RLS_ASYNC_HAVE_THREADS
+    pthread_t worker;
+#endif
+
+    RLS_ASYNC_ALIGN RLS_Async_Sample_T queue[RLS_ASYNC_QUEUE_SIZE];
+};
+
+#ifdef RLS_ASYNC_HAVE_THREADS
+
+/**
+ * @brief seqlock 쓰기: theta와 반영 샘플 수 게시
+ */
+static void RLS_Async_Publish(RLS_Async_T* async, uint32_T samples)
+{
+    uint32_T seq = __atomic_load_n(&async->sequence, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&async->sequence, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    for (uint32_T i = 0; i < async->num_parameters; i++) {
+        real_T value = async->rls.internal.theta[i];
+        __atomic_store(&async->theta[i], &value, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&async->published, samples, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&async->sequence, seq + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief 작업 스레드: 링에서 샘플을 꺼내 RLS 업데이트 후 게시
+ */
+static void* RLS_Async_Worker(void* arg)
+{
+    RLS_Async_T* async = (RLS_Async_T*)arg;
+    uint32_T tail = async->tail;
+    uint32_T idle = 0;
+
+    while (__atomic_load_n(&async->running, __ATOMIC_ACQUIRE)) {
+        uint32_T head = __atomic_load_n(&async->head, __ATOMIC_ACQUIRE);
+
+        if (tail == head) {
+            /* 유휴: 잠시 양보하다가 잠듦 */
+            if (++idle < RLS_ASYNC_SPIN_LIMIT) {
+                sched_yield();
+            } else {
+                struct timespec ts = { 0, RLS_ASYNC_IDLE_SLEEP_NS };
+                nanosleep(&ts, NULL);
+            }
+            continue;
+        }
+        idle = 0;
+
+        /* 쌓인 샘플을 모두 처리한 뒤 한 번만 게시 */
+        while (tail != head) {
+            const RLS_Async_Sample_T* sample = &async->queue[tail & RLS_ASYNC_QUEUE_MASK];
+            RLS_Update(&async->rls, sample->phi, sample->y);
+            tail++;
+            __atomic_store_n(&async->tail, tail, __ATOMIC_RELEASE);
+        }
+
+        RLS_Async_Publish(async, tail);
+    }
+
+    return NULL;
+}
+
+#endif /* RLS_ASYNC_HAVE_THREADS */
+
+/**
+ * @brief 비동기 RLS 생성 및 작업 스레드 시작
+ */
+RLS_Async_T* RLS_Async_Create(const RLS_Params_T* params, uint32_T num_parameters)
+{
+#ifdef RLS_ASYNC_HAVE_THREADS
+    if (params == NULL || num_parameters == 0 || num_parameters > RLS_ASYNC_MAX_PARAMETERS) {
+        return NULL;
+    }
+
+    /* 구조체가 자기 계정을 담으므로 지역 계정으로 할당한 뒤 옮김 */
+    Mem_Account_T memory;
+    Mem_Reset(&memory);
+    RLS_Async_T* async = (RLS_Async_T*)Mem_AlignedAlloc(&memory, RLS_ASYNC_CACHE_LINE, sizeof(RLS_Async_T));
+    if (async == NULL) {
+        return NULL;
+    }
+
+    memset(async, 0, sizeof(RLS_Async_T));
+    async->num_parameters = num_parameters;
+    async->memory = memory;
+
+    if (!RLS_Initialize(&async->rls, params, num_parameters)) {
+        Mem_Free(&memory, async);
+        return NULL;
+    }
+
+    memcpy(async->theta, async->rls.internal.theta, num_parameters * sizeof(real_T));
+    async->running = 1;
+
+    if (pthread_create(&async->worker, NULL, RLS_Async_Worker, async) != 0) {
+        RLS_Cleanup(&async->rls);
+        Mem_Free(&memory, async);
+        return NULL;
+    }
+
+    Mem_Seal(&async->memory);
+    return async;
+#else
+    (void)params;
+    (void)num_parameters;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief 작업 스레드 종료 및 해제
+ */
+void RLS_Async_Destroy(RLS_Async_T* async)
+{
+    if (async == NULL) {
+        return;
+    }
+
+#ifdef RLS_ASYNC_HAVE_THREADS
+    __atomic_store_n(&async->running, 0, __ATOMIC_RELEASE);
+    pthread_join(async->worker, NULL);
+#endif
+
+    RLS_Cleanup(&async->rls);
+    Mem_Account_T memory = async->memory;
+    Mem_Free(&memory, async);
+}
+
+/**
+ * @brief 회귀 샘플 게시 (스텝 스레드, 블록되지 않음)
+ */
+boolean_T RLS_Async_Post(RLS_Async_T* async, const real_T* phi, real_T y)
+{
+    if (async == NULL || phi == NULL) {
+        return false;
+    }
+
+    uint32_T head = async->head;
+    uint32_T tail = __atomic_load_n(&async->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= RLS_ASYNC_QUEUE_SIZE) {
+        async->dropped++;
+        return false;
+    }
+
+    RLS_Async_Sample_T* sample = &async->queue[head & RLS_ASYNC_QUEUE_MASK];
+    memcpy(sample->phi, phi, async->num_parameters * sizeof(real_T));
+    sample->y = y;
+
+    __atomic_store_n(&async->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief 최신 파라미터 읽기 (스텝 스레드, 찢어진 읽기 없음)
+ */
+uint32_T RLS_Async_GetParameters(const RLS_Async_T* async, real_T* theta, uint32_T num_parameters)
+{
+    if (async == NULL || theta == NULL) {
+        return 0;
+    }
+
+    uint32_T n = (num_parameters < async->num_parameters) ? num_parameters : async->num_parameters;
+    uint32_T seq_begin;
+    uint32_T seq_end = 0;
+    uint32_T published = 0;
+
+    /* seqlock 읽기: 쓰기 중이거나 읽는 사이 시퀀스가 바뀌면 다시 읽음 */
+    do {
+        seq_begin = __atomic_load_n(&async->sequence, __ATOMIC_ACQUIRE);
+        if (seq_begin & 1u) {
+            continue;
+        }
+
+        for (uint32_T i = 0; i < n; i++) {
+            __atomic_load(&async->theta[i], &theta[i], __ATOMIC_RELAXED);
+        }
+        published = __atomic_load_n(&async->published, __ATOMIC_RELAXED);
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seq_end = __atomic_load_n(&async->sequence, __ATOMIC_RELAXED);
+    } while ((seq_begin & 1u) || seq_begin != seq_end);
+
+    return published;
+}
+
+/**
+ * @brief 게시한 샘플이 모두 반영될 때까지 대기
+ */
+void RLS_Async_Flush(RLS_Async_T* async)
+{
+    if (async == NULL) {
+        return;
+    }
+
+#ifdef RLS_ASYNC_HAVE_THREADS
+    uint32_T head = async->head;
+
+    while (__atomic_load_n(&async->published, __ATOMIC_ACQUIRE) != head) {
+        sched_yield();
+    }
+#endif
+}
+
+/**
+ * @brief 링이 가득 차서 버려진 샘플 수
+ */
+uint32_T RLS_Async_GetDropped(const RLS_Async_T* async)
+{
+    if (async == NULL) {
+        return 0;
+    }
+    return async->dropped;
+}
+
+/**
+ * @brief 할당 계정 (구조체 + 작업 스레드 RLS 버퍼)
+ */
+void RLS_Async_GetMemory(const RLS_Async_T* async, Mem_Account_T* memory)
+{
+    if (async == NULL || memory == NULL) {
+        return;
+    }
+
+    Mem_Accumulate(memory, &async->memory);
+    Mem_Accumulate(memory, &async->rls.internal.memory);
+}
@@ -0,0 +1,196 @@
+/*
+ * rls_parallel.c
+ *
+ * 병렬 RLS 일괄 식별 모듈 구현
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "rls_parallel.h"
+#include "cholesky.h"
+#include <string.h>
+#include <math.h>
+
+#if !defined(_WIN32)
+    #include <pthread.h>
+    #include <unistd.h>
+    #define RLS_PARALLEL_HAVE_THREADS  1
+#endif
+
+/* 청크 부분합 (작업 스레드 하나가 담당) */
+typedef struct {
+    const real_T* phi;
+    const real_T* y;
+    size_t begin;
+    size_t end;
+    uint32_T dim;
+    real_T lambda;
+
+    /* 청크 끝 기준 가중 부분합 (상삼각만 누적) */
+    real_T R[RLS_PARALLEL_MAX_PARAMETERS * RLS_PARALLEL_MAX_PARAMETERS];
+    real_T r[RLS_PARALLEL_MAX_PARAMETERS];
+} RLS_Parallel_Chunk_T;
+
+/**
+ * @brief 청크 부분합: R = lambda * R + phi * phi^T, r = lambda * r + phi * y
+ * (호너 형태로 누적하여 청크 끝 기준 lambda^(end-1-k) 가중이 됨)
+ */
+static void RLS_Parallel_Accumulate(RLS_Parallel_Chunk_T* chunk)
+{
+    uint32_T dim = chunk->dim;
+    real_T lambda = chunk->lambda;
+
+    memset(chunk->R, 0, sizeof(chunk->R));
+    memset(chunk->r, 0, sizeof(chunk->r));
+
+    for (size_t k = chunk->begin; k < chunk->end; k++) {
+        const real_T* phi = &chunk->phi[k * dim];
+        real_T y = chunk->y[k];
+
+        for (uint32_T i = 0; i < dim; i++) {
+            real_T* row = &chunk->R[i * dim];
+            for (uint32_T j = i; j < dim; j++) {
+                row[j] = lambda * row[j] + phi[i] * phi[j];
+            }
+            chunk->r[i] = lambda * chunk->r[i] + phi[i] * y;
+        }
+    }
+}
+
+#ifdef RLS_PARALLEL_HAVE_THREADS
+static void* RLS_Parallel_Thread(void* arg)
+{
+    RLS_Parallel_Accumulate((RLS_Parallel_Chunk_T*)arg);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief 사용할 청크 개수 결정
+ */
+static uint32_T RLS_Parallel_ChunkCount(uint32_T threads, size_t n)
+{
+#ifdef RLS_PARALLEL_HAVE_THREADS
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? (uint32_T)online : 1;
+    }
+#else
+    threads = 1;
+#endif
+
+    if (threads > RLS_PARALLEL_MAX_THREADS) {
+        threads = RLS_PARALLEL_MAX_THREADS;
+    }
+
+    size_t by_size = n / RLS_PARALLEL_MIN_CHUNK;
+    if (by_size < threads) {
+        threads = (by_size > 0) ? (uint32_T)by_size : 1;
+    }
+    return threads;
+}
+
+/**
+ * @brief 기록 전체로 RLS 파라미터를 병렬 식별
+ */
+boolean_T RLS_FitParallel(RLS_T* rls, const real_T* phi, const real_T* y, size_t n,
+                          uint32_T num_threads)
+{
+    if (rls == NULL || phi == NULL || y == NULL || !rls->internal.initialized ||
+        rls->internal.num_parameters > RLS_PARALLEL_MAX_PARAMETERS) {
+        return false;
+    }
+    if (n == 0) {
+        return true;
+    }
+
+    uint32_T dim = rls->internal.num_parameters;
+    real_T lambda = rls->params.lambda;
+
+    /* 청크별 부분합 (병렬) */
+    RLS_Parallel_Chunk_T chunks[RLS_PARALLEL_MAX_THREADS];
+    uint32_T count = RLS_Parallel_ChunkCount(num_threads, n);
+
+    for (uint32_T c = 0; c < count; c++) {
+        chunks[c].phi = phi;
+        chunks[c].y = y;
+        chunks[c].begin = n * c / count;
+        chunks[c].end = n * (c + 1) / count;
+        chunks[c].dim = dim;
+        chunks[c].lambda = lambda;
+    }
+
+#ifdef RLS_PARALLEL_HAVE_THREADS
+    pthread_t threads[RLS_PARALLEL_MAX_THREADS];
+    boolean_T started[RLS_PARALLEL_MAX_THREADS];
+
+    for (uint32_T c = 1; c < count; c++) {
+        started[c] = (boolean_T)(pthread_create(&threads[c], NULL, RLS_Parallel_Thread, &chunks[c]) == 0);
+    }
+    RLS_Parallel_Accumulate(&chunks[0]);
+    for (uint32_T c = 1; c < count; c++) {
+        if (started[c]) {
+            pthread_join(threads[c], NULL);
+        } else {
+            RLS_Parallel_Accumulate(&chunks[c]);
+        }
+    }
+#else
+    for (uint32_T c = 0; c < count; c++) {
+        RLS_Parallel_Accumulate(&chunks[c]);
+    }
+#endif
+
+    /* 사전 정보: P_0^-1, P_0^-1 * theta_0 */
+    real_T info[RLS_PARALLEL_MAX_PARAMETERS * RLS_PARALLEL_MAX_PARAMETERS];
+    real_T info_vector[RLS_PARALLEL_MAX_PARAMETERS];
+    real_T L[RLS_PARALLEL_MAX_PARAMETERS * RLS_PARALLEL_MAX_PARAMETERS];
+
+    memcpy(L, rls->internal.P, dim * dim * sizeof(real_T));
+    if (!Cholesky_Factor(L, dim)) {
+        return false;
+    }
+    Cholesky_Inverse(L, info, dim);
+
+    for (uint32_T i = 0; i < dim; i++) {
+        info_vector[i] = 0.0;
+        for (uint32_T j = 0; j < dim; j++) {
+            info_vector[i] += info[i * dim + j] * rls->internal.theta[j];
+        }
+    }
+
+    /* 합치기: 사전 정보는 lambda^n, 청크는 청크 끝에서 기록 끝까지 lambda^(n-end) 가중 */
+    real_T prior_weight = pow(lambda, (real_T)n);
+    for (uint32_T i = 0; i < dim; i++) {
+        info_vector[i] *= prior_weight;
+        for (uint32_T j = i; j < dim; j++) {
+            info[i * dim + j] *= prior_weight;
+        }
+    }
+
+    for (uint32_T c = 0; c < count; c++) {
+        real_T weight = pow(lambda, (real_T)(n - chunks[c].end));
+        for (uint32_T i = 0; i < dim; i++) {
+            info_vector[i] += weight * chunks[c].r[i];
+            for (uint32_T j = i; j < dim; j++) {
+                info[i * dim + j] += weight * chunks[c].R[i * dim + j];
+            }
+        }
+    }
+
+    for (uint32_T i = 0; i < dim; i++) {
+        for (uint32_T j = 0; j < i; j++) {
+            info[i * dim + j] = info[j * dim + i];
+        }
+    }
+
+    /* theta = info^-1 * info_vector, P = info^-1 */
+    if (!Cholesky_Factor(info, dim)) {
+        return false;
+    }
+    Cholesky_Solve(info, info_vector, dim);
+    Cholesky_Inverse(info, rls->internal.P, dim);
+    memcpy(rls->internal.theta, info_vector, dim * sizeof(real_T));
+
+    return true;
+}
@@ -0,0 +1,277 @@
+/*
+ * rt_mode.c
+ *
+ * 실시간 실행 모드 모듈 구현
+ */
+
+#define _GNU_SOURCE
+
+#include "rt_mode.h"
+#include <errno.h>
+#include <string.h>
+
+#if defined(__linux__)
+    #include <sched.h>
+    #include <time.h>
+    #include <sys/mman.h>
+    #define RT_HAVE_LINUX  1
+#endif
+
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
+#if defined(__SSE__) || defined(__x86_64__)
+    #include <xmmintrin.h>
+    #define RT_HAVE_MXCSR  1
+    #define RT_MXCSR_DAZ   0x0040u         /* 비정규 입력을 0으로 */
+    #define RT_MXCSR_FTZ   0x8000u         /* 비정규 결과를 0으로 */
+#elif defined(__aarch64__)
+    #define RT_HAVE_FPCR   1
+    #define RT_FPCR_FZ     (1u << 24)      /* Flush-to-zero */
+#endif
+
+/* 상수 정의 */
+#define RT_PAGE_SIZE               4096    /* prefault 간격 (가장 작은 페이지 크기) */
+#define RT_NS_PER_S                1000000000LL
+
+/**
+ * @brief 스택 미리 접근 (재귀 없이 지역 배열 한 번)
+ * 컴파일러가 배열을 제거하지 않도록 volatile로 접근
+ */
+static void RT_PrefaultStack(size_t bytes)
+{
+#ifdef RT_HAVE_LINUX
+    volatile unsigned char* stack = (volatile unsigned char*)__builtin_alloca(bytes);
+    for (size_t i = 0; i < bytes; i += RT_PAGE_SIZE) {
+        stack[i] = 0;
+    }
+#else
+    (void)bytes;
+#endif
+}
+
+static uint64_t RT_GetFpControl(void)
+{
+#if defined(RT_HAVE_MXCSR)
+    return (uint64_t)_mm_getcsr();
+#elif defined(RT_HAVE_FPCR)
+    uint64_t fpcr;
+    __asm__ volatile("mrs %0, fpcr" : "=r"(fpcr));
+    return fpcr;
+#else
+    return 0;
+#endif
+}
+
+static boolean_T RT_SetFpControl(uint64_t value)
+{
+#if defined(RT_HAVE_MXCSR)
+    _mm_setcsr((unsigned int)value);
+    return true;
+#elif defined(RT_HAVE_FPCR)
+    __asm__ volatile("msr fpcr, %0" : : "r"(value));
+    return true;
+#else
+    (void)value;
+    return false;
+#endif
+}
+
+/**
+ * @brief 실시간 모드 진입 (호출 스레드에 적용)
+ */
+boolean_T RT_Enter(const RT_Config_T* config, RT_Status_T* status)
+{
+    if (config == NULL || status == NULL) {
+        return false;
+    }
+
+    memset(status, 0, sizeof(RT_Status_T));
+    status->saved_fp_control = RT_GetFpControl();
+    boolean_T complete = true;
+
+    /* 메모리 고정: 해제한 메모리를 돌려주지 않도록 한 뒤 현재 / 이후 매핑 고정 */
+    if (config->lock_memory) {
+#if defined(__GLIBC__)
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+#endif
+#ifdef RT_HAVE_LINUX
+        status->memory_locked = (boolean_T)(mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+#endif
+        complete = (boolean_T)(complete && status->memory_locked);
+    }
+
+    if (config->prefault_stack > 0) {
+        RT_PrefaultStack(config->prefault_stack);
+    }
+
+#ifdef RT_HAVE_LINUX
+    /* CPU 고정 (RT_Leave 복원용으로 이전 CPU 집합 저장) */
+    if (config->cpu >= 0) {
+        cpu_set_t set;
+        if (sizeof(cpu_set_t) <= sizeof(status->saved_affinity) &&
+            sched_getaffinity(0, sizeof(set), &set) == 0) {
+            memcpy(status->saved_affinity, &set, sizeof(set));
+            status->affinity_saved = true;
+        }
+        CPU_ZERO(&set);
+        CPU_SET(config->cpu, &set);
+        status->pinned = (boolean_T)(sched_setaffinity(0, sizeof(set), &set) == 0);
+        complete = (boolean_T)(complete && status->pinned);
+    }
+
+    /* SCHED_FIFO (권한이 없으면 EPERM, 기존 정책 유지) */
+    struct sched_param param;
+    status->saved_policy = (int32_T)sched_getscheduler(0);
+    status->saved_priority = (sched_getparam(0, &param) == 0) ? (int32_T)param.sched_priority : 0;
+    if (config->priority > 0) {
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = config->priority;
+        status->fifo = (boolean_T)(sched_setscheduler(0, SCHED_FIFO, &param) == 0);
+        complete = (boolean_T)(complete && status->fifo);
+    }
+#else
+    complete = (boolean_T)(complete && config->cpu < 0 && config->priority <= 0);
+#endif
+
+    /* 비정규 수 처리: 감쇠하는 공분산 / 게인이 비정규 영역에서 수십 배 느려지는 것을 방지 */
+    if (config->flush_denormals) {
+#if defined(RT_HAVE_MXCSR)
+        status->denormals_flushed = RT_SetFpControl(status->saved_fp_control | RT_MXCSR_DAZ | RT_MXCSR_FTZ);
+#elif defined(RT_HAVE_FPCR)
+        status->denormals_flushed = RT_SetFpControl(status->saved_fp_control | RT_FPCR_FZ);
+#endif
+        complete = (boolean_T)(complete && status->denormals_flushed);
+    }
+
+    return complete;
+}
+
+/**
+ * @brief 실시간 모드 해제
+ */
+void RT_Leave(const RT_Status_T* status)
+{
+    if (status == NULL) {
+        return;
+    }
+
+    if (status->denormals_flushed) {
+        RT_SetFpControl(status->saved_fp_control);
+    }
+
+#ifdef RT_HAVE_LINUX
+    if (status->fifo) {
+        struct sched_param param;
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = status->saved_priority;
+        sched_setscheduler(0, status->saved_policy, &param);
+    }
+    if (status->pinned && status->affinity_saved) {
+        cpu_set_t set;
+        memcpy(&set, status->saved_affinity, sizeof(set));
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+    if (status->memory_locked) {
+        munlockall();
+    }
+#endif
+}
+
+/**
+ * @brief 메모리 영역의 모든 페이지를 미리 접근 (값은 바꾸지 않음)
+ */
+void RT_Prefault(void* data, size_t bytes)
+{
+    if (data == NULL || bytes == 0) {
+        return;
+    }
+
+    /* 읽기만 하면 0 페이지가 공유 매핑되므로 같은 값을 다시 써서 쓰기 폴트까지 발생 */
+    volatile unsigned char* p = (volatile unsigned char*)data;
+    for (size_t i = 0; i < bytes; i += RT_PAGE_SIZE) {
+        p[i] = p[i];
+    }
+    p[bytes - 1] = p[bytes - 1];
+}
+
+#ifdef RT_HAVE_LINUX
+static int64_t RT_Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * RT_NS_PER_S + (int64_t)ts.tv_nsec;
+}
+#endif
+
+/**
+ * @brief 절대 시각 기준 주기 실행
+ */
+boolean_T RT_RunPeriodic(real_T period, size_t steps, RT_StepFunction_T step, void* context,
+                         RT_Stats_T* stats)
+{
+    if (step == NULL || stats == NULL || !(period > 0.0)) {
+        return false;
+    }
+
+    memset(stats, 0, sizeof(RT_Stats_T));
+
+#ifdef RT_HAVE_LINUX
+    int64_t period_ns = (int64_t)(period * 1e9 + 0.5);
+    if (period_ns <= 0) {
+        return false;
+    }
+
+    int64_t total_ns = 0;
+    int64_t release = RT_Now() + period_ns;
+    boolean_T slept = true;
+
+    for (size_t k = 0; k < steps; k++) {
+        struct timespec wake;
+        wake.tv_sec = (time_t)(release / RT_NS_PER_S);
+        wake.tv_nsec = (long)(release % RT_NS_PER_S);
+        int error;
+        do {
+            /* 시그널로 깨어나면 다시 대기 */
+            error = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+        } while (error == EINTR);
+        if (error != 0) {
+            slept = false;
+            break;
+        }
+
+        int64_t start = RT_Now();
+        step(context, k);
+        int64_t end = RT_Now();
+
+        int64_t elapsed = end - start;
+        total_ns += elapsed;
+        if ((real_T)elapsed * 1e-9 > stats->step_max) {
+            stats->step_max = (real_T)elapsed * 1e-9;
+            stats->step_max_index = (uint64_t)k;
+        }
+        if ((real_T)(start - release) * 1e-9 > stats->wakeup_max) {
+            stats->wakeup_max = (real_T)(start - release) * 1e-9;
+        }
+
+        /* 마감: 다음 주기 시작 시각. 넘겼으면 밀린 주기는 건너뜀 */
+        release += period_ns;
+        if (end > release) {
+            int64_t behind = (end - release) / period_ns + 1;
+            stats->deadline_misses++;
+            stats->skipped_periods += (uint64_t)behind;
+            release += behind * period_ns;
+        }
+        stats->steps++;
+    }
+
+    stats->step_mean = (stats->steps > 0) ? (real_T)total_ns * 1e-9 / (real_T)stats->steps : 0.0;
+    return slept;
+#else
+    (void)steps;
+    (void)context;
+    return false;
+#endif
+}
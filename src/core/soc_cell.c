@@ -0,0 +1,395 @@
+/*
+ * soc_cell.c
+ *
+ * 셀 단위 SoC 추정 모듈 구현
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "soc_cell.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 단계별 시간 측정 타이머 */
+#ifdef SOC_PROFILE
+    #if defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+        #define SOC_CELL_PROFILE_UNIT  "TSC"
+    #else
+        #include <time.h>
+        #define SOC_CELL_PROFILE_UNIT  "ns"
+    #endif
+#endif
+
+/* 상수 정의 */
+#define SOC_CELL_MIN_SOC       0.0     /* 최소 SoC */
+#define SOC_CELL_MAX_SOC       1.0     /* 최대 SoC */
+
+#if (SOC_CELL_PROFILE_PERIOD & (SOC_CELL_PROFILE_PERIOD - 1)) != 0
+    #error "SOC_CELL_PROFILE_PERIOD는 2의 거듭제곱이어야 함"
+#endif
+
+#ifdef SOC_PROFILE
+static inline uint64_t SoC_Cell_ProfileNow(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint64_t)__rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* 구간 종료: 직전 경계부터의 시간을 누적하고 경계 갱신 (구간 사이 타임스탬프 공유) */
+static inline void SoC_Cell_ProfileMark(SoC_Cell_ProfileCounter_T* counter, uint64_t* last)
+{
+    uint64_t now = SoC_Cell_ProfileNow();
+    counter->ticks += now - *last;
+    counter->calls++;
+    *last = now;
+}
+
+#define SOC_CELL_PROFILE_MARK(cell, stage) \
+    do { \
+        if (profiling) { \
+            SoC_Cell_ProfileMark(&(cell)->profile_stage[stage], &profile_last); \
+        } \
+    } while (0)
+#else
+#define SOC_CELL_PROFILE_MARK(cell, stage) ((void)0)
+#endif
+
+/**
+ * @brief 이번 샘플에서 단계 실행 여부 판정
+ */
+static boolean_T SoC_Cell_IsDue(const SoC_Cell_T* cell, uint32_T every, uint32_T stage)
+{
+    if ((cell->requested & stage) != 0) {
+        return true;
+    }
+    return (boolean_T)(every != 0 && cell->sample_count % every == 0);
+}
+
+/**
+ * @brief 쿨롱 카운팅을 반영한 현재 SoC 추정값
+ * EKF 상태에 측정 업데이트 대기 중인 전하량을 더한 값
+ */
+static real_T SoC_Cell_CountedSoC(const SoC_Cell_T* cell)
+{
+    real_T soc = EKF_GetSoC(&cell->ekf) -
+                 cell->sampling_time / (cell->battery_capacity * 3600.0) * cell->pending_current_sum;
+
+    if (soc > SOC_CELL_MAX_SOC) {
+        soc = SOC_CELL_MAX_SOC;
+    } else if (soc < SOC_CELL_MIN_SOC) {
+        soc = SOC_CELL_MIN_SOC;
+    }
+    return soc;
+}
+
+/**
+ * @brief 셀 초기화
+ */
+boolean_T SoC_Cell_Initialize(SoC_Cell_T* cell, const SoC_Cell_Config_T* config)
+{
+    if (cell == NULL || config == NULL || config->soc_breakpoints == NULL ||
+        config->ocv_data == NULL || config->docv_data == NULL) {
+        return false;
+    }
+
+    memset(cell, 0, sizeof(SoC_Cell_T));
+
+    cell->sampling_time = config->sampling_time;
+    cell->battery_capacity = config->battery_capacity;
+    cell->schedule = config->schedule;
+
+    /* EKF 초기화 */
+    if (!EKF_Initialize(&cell->ekf, &config->ekf)) {
+        return false;
+    }
+    EKF_SetSteadyState(&cell->ekf, &config->ekf_steady);
+    EKF_SetGainSchedule(&cell->ekf, config->ekf_gain_table);
+
+    /* RLS 초기화 */
+    if (!RLS_Initialize(&cell->rls, &config->rls, SOC_CELL_RLS_PARAMETERS)) {
+        EKF_Cleanup(&cell->ekf);
+        return false;
+    }
+    RLS_SetExcitation(&cell->rls, &config->rls_excitation);
+
+    /* 파이프라인 모드: 작업 스레드를 만들 수 없으면 동기 RLS로 동작 */
+    if (config->rls_async) {
+        cell->rls_async = RLS_Async_Create(&config->rls, SOC_CELL_RLS_PARAMETERS);
+    }
+
+    /* Lookup Table 초기화 */
+    LookupTable_Params_T table_params;
+    table_params.max_points = config->table_points;
+    table_params.use_binary_search = true;
+    table_params.enable_extrapolation = true;
+
+    if (!LookupTable_Initialize(&cell->ocv_table, &table_params, config->soc_breakpoints,
+                                config->ocv_data, config->table_points)) {
+        RLS_Async_Destroy(cell->rls_async);
+        RLS_Cleanup(&cell->rls);
+        EKF_Cleanup(&cell->ekf);
+        return false;
+    }
+
+    if (!LookupTable_Initialize(&cell->docv_table, &table_params, config->soc_breakpoints,
+                                config->docv_data, config->table_points)) {
+        LookupTable_Cleanup(&cell->ocv_table);
+        RLS_Async_Destroy(cell->rls_async);
+        RLS_Cleanup(&cell->rls);
+        EKF_Cleanup(&cell->ekf);
+        return false;
+    }
+
+    cell->soc = EKF_GetSoC(&cell->ekf);
+    cell->initialized = true;
+
+    return true;
+}
+
+/**
+ * @brief 셀 해제 (메모리 정리)
+ */
+void SoC_Cell_Cleanup(SoC_Cell_T* cell)
+{
+    if (cell == NULL || !cell->initialized) {
+        return;
+    }
+
+    LookupTable_Cleanup(&cell->docv_table);
+    LookupTable_Cleanup(&cell->ocv_table);
+    RLS_Async_Destroy(cell->rls_async);
+    cell->rls_async = NULL;
+    RLS_Cleanup(&cell->rls);
+    EKF_Cleanup(&cell->ekf);
+    cell->initialized = false;
+}
+
+/**
+ * @brief 셀 한 스텝 실행 (입력 샘플 하나)
+ */
+real_T SoC_Cell_Step(SoC_Cell_T* cell, real_T current, real_T voltage)
+{
+    if (cell == NULL || !cell->initialized) {
+        return 0.0;
+    }
+
+    /* 입력 값 저장 */
+    cell->current = current;
+    cell->voltage = voltage;
+    cell->sample_count++;
+
+#ifdef SOC_PROFILE
+    /* 표본 스텝에서만 타임스탬프 읽기 */
+    boolean_T profiling = (boolean_T)((cell->sample_count & (SOC_CELL_PROFILE_PERIOD - 1)) == 0);
+    uint64_t profile_start = profiling ? SoC_Cell_ProfileNow() : 0;
+    uint64_t profile_last = profile_start;
+#endif
+
+    /* 이번 샘플 적분 전의 SoC (조회 및 회귀 벡터에 사용) */
+    real_T current_soc = SoC_Cell_CountedSoC(cell);
+    SOC_CELL_PROFILE_MARK(cell, SOC_CELL_PROFILE_CLAMP);
+
+    /* OCV 및 dOCV/dSOC 계산 */
+    if (SoC_Cell_IsDue(cell, cell->schedule.lookup_every, SOC_CELL_STAGE_LOOKUP)) {
+        cell->ocv = LookupTable_Interpolate(&cell->ocv_table, current_soc);
+        SOC_CELL_PROFILE_MARK(cell, SOC_CELL_PROFILE_OCV);
+        cell->docv_dsoc = LookupTable_Interpolate(&cell->docv_table, current_soc);
+        SOC_CELL_PROFILE_MARK(cell, SOC_CELL_PROFILE_DOCV);
+    }
+
+    /* RLS 업데이트 */
+    if (SoC_Cell_IsDue(cell, cell->schedule.rls_every, SOC_CELL_STAGE_RLS)) {
+        real_T phi[SOC_CELL_RLS_PARAMETERS];
+        phi[0] = 1.0;                  /* 상수항 */
+        phi[1] = current;              /* 전류 */
+        phi[2] = current_soc;          /* SoC */
+
+        if (cell->rls_async != NULL) {
+            RLS_Async_Post(cell->rls_async, phi, voltage);
+        } else {
+            RLS_Update(&cell->rls, phi, voltage);
+        }
+        SOC_CELL_PROFILE_MARK(cell, SOC_CELL_PROFILE_RLS);
+    }
+
+    /* 전류 적분 (매 샘플) */
+    cell->pending_current_sum += current;
+    cell->pending_steps++;
+
+    /* EKF 측정 업데이트: 대기 중인 전류를 한 번에 예측한 뒤 업데이트 */
+    if (SoC_Cell_IsDue(cell, cell->schedule.update_every, SOC_CELL_STAGE_UPDATE)) {
+        EKF_PredictSum(&cell->ekf, cell->pending_current_sum, cell->pending_steps, cell->sampling_time);
+        EKF_Update(&cell->ekf, voltage, current);
+        cell->pending_current_sum = 0.0;
+        cell->pending_steps = 0;
+    }
+    SOC_CELL_PROFILE_MARK(cell, SOC_CELL_PROFILE_EKF);
+
+    cell->requested = 0;
+    cell->soc = SoC_Cell_CountedSoC(cell);
+    SOC_CELL_PROFILE_MARK(cell, SOC_CELL_PROFILE_CLAMP);
+
+#ifdef SOC_PROFILE
+    if (profiling) {
+        cell->profile_step.ticks += profile_last - profile_start;
+        cell->profile_step.calls++;
+    }
+#endif
+
+    return cell->soc;
+}
+
+/**
+ * @brief 최신 RLS 파라미터 읽기
+ */
+void SoC_Cell_GetParameters(const SoC_Cell_T* cell, real_T* theta)
+{
+    if (cell == NULL || theta == NULL || !cell->initialized) {
+        return;
+    }
+
+    if (cell->rls_async != NULL) {
+        RLS_Async_GetParameters(cell->rls_async, theta, SOC_CELL_RLS_PARAMETERS);
+    } else {
+        RLS_GetParameters(&cell->rls, theta, SOC_CELL_RLS_PARAMETERS);
+    }
+}
+
+/**
+ * @brief 단계별 실행 주기 변경
+ */
+void SoC_Cell_SetSchedule(SoC_Cell_T* cell, const SoC_Schedule_T* schedule)
+{
+    if (cell == NULL || schedule == NULL) {
+        return;
+    }
+
+    cell->schedule = *schedule;
+}
+
+/**
+ * @brief 다음 스텝에서 주기와 관계없이 단계 실행 요청
+ */
+void SoC_Cell_Request(SoC_Cell_T* cell, uint32_T stages)
+{
+    if (cell == NULL) {
+        return;
+    }
+
+    cell->requested |= (stages & SOC_CELL_STAGE_ALL);
+}
+
+/**
+ * @brief 단계별 시간 측정 결과 읽기
+ */
+void SoC_Cell_GetProfile(const SoC_Cell_T* cell, SoC_Cell_Profile_T* profile)
+{
+    if (profile == NULL) {
+        return;
+    }
+
+    memset(profile, 0, sizeof(SoC_Cell_Profile_T));
+#ifdef SOC_PROFILE
+    profile->period = SOC_CELL_PROFILE_PERIOD;
+    profile->unit = SOC_CELL_PROFILE_UNIT;
+#else
+    profile->unit = "";
+#endif
+    if (cell == NULL) {
+        return;
+    }
+
+    memcpy(profile->stage, cell->profile_stage, sizeof(profile->stage));
+    profile->step = cell->profile_step;
+}
+
+/**
+ * @brief 단계별 시간 측정 카운터 초기화
+ */
+void SoC_Cell_ResetProfile(SoC_Cell_T* cell)
+{
+    if (cell == NULL) {
+        return;
+    }
+
+    memset(cell->profile_stage, 0, sizeof(cell->profile_stage));
+    memset(&cell->profile_step, 0, sizeof(cell->profile_step));
+}
+
+/**
+ * @brief 셀이 소유한 힙 할당 집계
+ */
+void SoC_Cell_GetMemory(const SoC_Cell_T* cell, Mem_Account_T* memory)
+{
+    if (memory == NULL) {
+        return;
+    }
+
+    Mem_Reset(memory);
+    if (cell == NULL) {
+        return;
+    }
+
+    Mem_Accumulate(memory, &cell->rls.internal.memory);
+    Mem_Accumulate(memory, &cell->ocv_table.memory);
+    Mem_Accumulate(memory, &cell->docv_table.memory);
+    RLS_Async_GetMemory(cell->rls_async, memory);
+}
+
+/**
+ * @brief 셀 상태 출력 (디버깅용)
+ */
+void SoC_Cell_PrintStatus(const SoC_Cell_T* cell)
+{
+    if (cell == NULL || !cell->initialized) {
+        printf("셀이 초기화되지 않았습니다.\n");
+        return;
+    }
+
+    printf("=== SoC 추정 시스템 상태 ===\n");
+    printf("전류: %.6f A\n", cell->current);
+    printf("전압: %.6f V\n", cell->voltage);
+    printf("SoC: %.6f\n", cell->soc);
+    printf("온도: %.6f °C\n", cell->temperature);
+    printf("샘플링 시간: %.6f s\n", cell->sampling_time);
+    printf("배터리 용량: %.6f Ah\n", cell->battery_capacity);
+    printf("실행 주기 (조회/RLS/업데이트): %u/%u/%u\n",
+           (unsigned)cell->schedule.lookup_every, (unsigned)cell->schedule.rls_every,
+           (unsigned)cell->schedule.update_every);
+    EKF_PrintStatus(&cell->ekf);
+    if (cell->rls_async == NULL) {
+        RLS_PrintStatus(&cell->rls);
+    }
+
+    Mem_Account_T memory;
+    SoC_Cell_GetMemory(cell, &memory);
+    printf("메모리: 구조체 %zu 바이트 + 힙 %zu 바이트 (할당 %u회, 봉인 후 할당 %u회)\n",
+           sizeof(SoC_Cell_T), memory.bytes, (unsigned)memory.allocations, (unsigned)memory.violations);
+
+    SoC_Cell_Profile_T profile;
+    SoC_Cell_GetProfile(cell, &profile);
+    if (profile.period != 0 && profile.step.calls > 0) {
+        static const char* const names[SOC_CELL_PROFILE_STAGES] = {
+            "ocv", "docv", "rls", "ekf", "clamp"
+        };
+        real_T step_average = (real_T)profile.step.ticks / (real_T)profile.step.calls;
+
+        printf("단계별 시간 (%s, %u 스텝마다 표본, 표본 %llu 스텝, 스텝 평균 %.1f):\n",
+               profile.unit, (unsigned)profile.period, (unsigned long long)profile.step.calls,
+               step_average);
+        for (int i = 0; i < SOC_CELL_PROFILE_STAGES; i++) {
+            const SoC_Cell_ProfileCounter_T* c = &profile.stage[i];
+            printf("  %-10s 호출당 %8.1f, 스텝당 %8.1f (%5.1f%%)\n", names[i],
+                   (c->calls > 0) ? (real_T)c->ticks / (real_T)c->calls : 0.0,
+                   (real_T)c->ticks / (real_T)profile.step.calls,
+                   (profile.step.ticks > 0) ? 100.0 * (real_T)c->ticks / (real_T)profile.step.ticks : 0.0);
+        }
+    }
+    printf("==========================\n");
+}
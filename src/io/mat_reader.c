@@ -0,0 +1,611 @@
+/*
+ * mat_reader.c
+ *
+ * MAT 5.0 파일 읽기 모듈 구현
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "mat_reader.h"
+#include "mem_account.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define MAT_HAVE_MMAP  1
+#endif
+
+/* MAT 5.0 데이터 형식 */
+#define MAT_MI_INT8                1
+#define MAT_MI_UINT8               2
+#define MAT_MI_INT16               3
+#define MAT_MI_UINT16              4
+#define MAT_MI_INT32               5
+#define MAT_MI_UINT32              6
+#define MAT_MI_SINGLE              7
+#define MAT_MI_DOUBLE              9
+#define MAT_MI_INT64               12
+#define MAT_MI_UINT64              13
+#define MAT_MI_MATRIX              14
+#define MAT_MI_COMPRESSED          15
+
+/* MAT 5.0 배열 클래스 (mxDOUBLE_CLASS .. mxUINT64_CLASS가 수치 배열) */
+#define MAT_MX_DOUBLE_CLASS        6
+#define MAT_MX_UINT64_CLASS        15
+#define MAT_FLAG_COMPLEX           0x0800u
+
+#define MAT_HEADER_SIZE            128
+
+/* 색인된 변수 */
+typedef struct {
+    char name[MAT_MAX_NAME];
+    boolean_T numeric;             /* 실수 수치 배열 여부 */
+    size_t rows;
+    size_t cols;
+    uint32_T data_type;            /* 실수부 데이터 형식 */
+    uint32_T data_bytes;           /* 실수부 바이트 수 */
+    boolean_T data_small;          /* 실수부가 작은 요소 (태그 안 4바이트) */
+    uint8_T small_data[4];
+
+    const uint8_T* element;        /* 최상위 요소 본문 (태그 다음) */
+    uint32_T element_bytes;
+    boolean_T compressed;
+
+    const real_T* data;            /* 읽은 데이터 (NULL이면 아직 읽지 않음) */
+    real_T* buffer;                /* 압축 해제 / 변환 버퍼 (소유) */
+} MAT_Entry_T;
+
+struct MAT_File_T {
+    const uint8_T* base;           /* 파일 내용 */
+    size_t size;
+    MAT_Entry_T* entries;
+    uint32_T count;
+    uint32_T capacity;
+};
+
+/* 요소 본문 읽기 (비압축은 매핑에서 직접, 압축은 zlib 스트리밍) */
+typedef struct {
+    const uint8_T* next;
+    size_t remaining;
+    boolean_T compressed;
+    z_stream z;
+} MAT_Stream_T;
+
+static size_t MAT_Pad8(size_t n)
+{
+    return (n + 7u) & ~(size_t)7u;
+}
+
+static uint32_T MAT_Load32(const uint8_T* p)
+{
+    uint32_T value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static boolean_T MAT_Stream_Open(MAT_Stream_T* stream, const MAT_Entry_T* entry)
+{
+    memset(stream, 0, sizeof(MAT_Stream_T));
+    stream->compressed = entry->compressed;
+
+    if (!entry->compressed) {
+        stream->next = entry->element;
+        stream->remaining = entry->element_bytes;
+        return true;
+    }
+
+    stream->z.next_in = (Bytef*)entry->element;
+    stream->z.avail_in = (uInt)entry->element_bytes;
+    return (boolean_T)(inflateInit(&stream->z) == Z_OK);
+}
+
+static void MAT_Stream_Close(MAT_Stream_T* stream)
+{
+    if (stream->compressed) {
+        inflateEnd(&stream->z);
+    }
+}
+
+/**
+ * @brief 요소 본문에서 n바이트 읽기
+ * 압축 요소는 MAT_CHUNK_SIZE씩 dst에 직접 압축 해제
+ */
+static boolean_T MAT_Stream_Read(MAT_Stream_T* stream, void* dst, size_t n)
+{
+    if (!stream->compressed) {
+        if (n > stream->remaining) {
+            return false;
+        }
+        memcpy(dst, stream->next, n);
+        stream->next += n;
+        stream->remaining -= n;
+        return true;
+    }
+
+    uint8_T* out = (uint8_T*)dst;
+    while (n > 0) {
+        size_t chunk = (n < MAT_CHUNK_SIZE) ? n : MAT_CHUNK_SIZE;
+
+        stream->z.next_out = out;
+        stream->z.avail_out = (uInt)chunk;
+        while (stream->z.avail_out > 0) {
+            int status = inflate(&stream->z, Z_NO_FLUSH);
+            if (status == Z_STREAM_END && stream->z.avail_out > 0) {
+                return false;  /* 요소가 선언보다 짧음 */
+            }
+            if (status != Z_OK && status != Z_STREAM_END) {
+                return false;
+            }
+        }
+        out += chunk;
+        n -= chunk;
+    }
+    return true;
+}
+
+static boolean_T MAT_Stream_Skip(MAT_Stream_T* stream, size_t n)
+{
+    if (!stream->compressed) {
+        if (n > stream->remaining) {
+            return false;
+        }
+        stream->next += n;
+        stream->remaining -= n;
+        return true;
+    }
+
+    uint8_T scratch[64];
+    while (n > 0) {
+        size_t chunk = (n < sizeof(scratch)) ? n : sizeof(scratch);
+        if (!MAT_Stream_Read(stream, scratch, chunk)) {
+            return false;
+        }
+        n -= chunk;
+    }
+    return true;
+}
+
+
+/**
+ * @brief 하위 요소 태그 읽기
+ * 작은 요소 형식(상위 16비트가 크기)이면 태그 안의 4바이트 본문을 small에 읽고 is_small = true
+ */
+static boolean_T MAT_Stream_Tag(MAT_Stream_T* stream, uint32_T* type, uint32_T* bytes,
+                                uint8_T* small, boolean_T* is_small)
+{
+    uint8_T tag[4];
+    if (!MAT_Stream_Read(stream, tag, 4)) {
+        return false;
+    }
+
+    uint32_T first = MAT_Load32(tag);
+    if ((first >> 16) != 0) {
+        *type = first & 0xFFFFu;
+        *bytes = first >> 16;
+        *is_small = true;
+        return (boolean_T)(*bytes <= 4 && MAT_Stream_Read(stream, small, 4));
+    }
+
+    if (!MAT_Stream_Read(stream, tag, 4)) {
+        return false;
+    }
+    *type = first;
+    *bytes = MAT_Load32(tag);
+    *is_small = false;
+    return true;
+}
+
+static size_t MAT_TypeSize(uint32_T type)
+{
+    switch (type) {
+        case MAT_MI_INT8:
+        case MAT_MI_UINT8:
+            return 1;
+        case MAT_MI_INT16:
+        case MAT_MI_UINT16:
+            return 2;
+        case MAT_MI_INT32:
+        case MAT_MI_UINT32:
+        case MAT_MI_SINGLE:
+            return 4;
+        case MAT_MI_DOUBLE:
+        case MAT_MI_INT64:
+        case MAT_MI_UINT64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief miMATRIX 본문의 헤더(플래그, 차원, 이름, 실수부 태그) 파싱
+ * 수치 배열이면 스트림은 실수부 데이터 시작 위치에서 멈춤
+ */
+static boolean_T MAT_ParseMatrix(MAT_Stream_T* stream, MAT_Entry_T* entry)
+{
+    uint32_T type;
+    uint32_T bytes;
+    uint8_T small[4];
+    boolean_T is_small;
+
+    /* 압축 요소는 풀린 내용이 miMATRIX 태그로 시작 */
+    if (stream->compressed) {
+        if (!MAT_Stream_Tag(stream, &type, &bytes, small, &is_small) || type != MAT_MI_MATRIX) {
+            return false;
+        }
+    }
+
+    /* 배열 플래그 */
+    uint8_T flags[8];
+    if (!MAT_Stream_Tag(stream, &type, &bytes, small, &is_small) || is_small ||
+        type != MAT_MI_UINT32 || bytes != 8 || !MAT_Stream_Read(stream, flags, 8)) {
+        return false;
+    }
+    uint32_T flag_word = MAT_Load32(flags);
+    uint32_T class_id = flag_word & 0xFFu;
+
+    /* 차원 (2차원 이상, 첫 차원이 행, 나머지의 곱이 열) */
+    if (!MAT_Stream_Tag(stream, &type, &bytes, small, &is_small) || is_small ||
+        type != MAT_MI_INT32 || bytes < 8 || (bytes % 4) != 0) {
+        return false;
+    }
+    entry->rows = 0;
+    entry->cols = 1;
+    for (uint32_T i = 0; i < bytes / 4; i++) {
+        uint8_T dim_bytes[4];
+        int32_T dim;
+        if (!MAT_Stream_Read(stream, dim_bytes, 4)) {
+            return false;
+        }
+        memcpy(&dim, dim_bytes, sizeof(dim));
+        if (dim < 0) {
+            return false;
+        }
+        if (i == 0) {
+            entry->rows = (size_t)dim;
+        } else {
+            entry->cols *= (size_t)dim;
+        }
+    }
+    if (!MAT_Stream_Skip(stream, MAT_Pad8(bytes) - bytes)) {
+        return false;
+    }
+
+    /* 이름 */
+    if (!MAT_Stream_Tag(stream, &type, &bytes, small, &is_small) || type != MAT_MI_INT8) {
+        return false;
+    }
+    size_t length = (bytes < MAT_MAX_NAME - 1) ? bytes : MAT_MAX_NAME - 1;
+    if (is_small) {
+        memcpy(entry->name, small, length);
+    } else if (!MAT_Stream_Read(stream, entry->name, length) ||
+               !MAT_Stream_Skip(stream, MAT_Pad8(bytes) - length)) {
+        return false;
+    }
+    entry->name[length] = '\0';
+
+    /* 실수 수치 배열만 실수부 태그까지 읽음 */
+    entry->numeric = (boolean_T)(class_id >= MAT_MX_DOUBLE_CLASS && class_id <= MAT_MX_UINT64_CLASS &&
+                                 (flag_word & MAT_FLAG_COMPLEX) == 0);
+    if (!entry->numeric) {
+        return true;
+    }
+
+    if (!MAT_Stream_Tag(stream, &type, &bytes, entry->small_data, &entry->data_small)) {
+        return false;
+    }
+    size_t type_size = MAT_TypeSize(type);
+    if (type_size == 0 || (size_t)bytes != entry->rows * entry->cols * type_size) {
+        entry->numeric = false;
+        return true;
+    }
+    entry->data_type = type;
+    entry->data_bytes = bytes;
+    return true;
+}
+
+/**
+ * @brief 원시 데이터를 real_T로 변환 (정렬되지 않은 원본 허용)
+ */
+static void MAT_Convert(uint32_T type, const uint8_T* src, size_t count, real_T* dst)
+{
+    for (size_t i = 0; i < count; i++) {
+        switch (type) {
+            case MAT_MI_INT8:   { int8_T v;   memcpy(&v, &src[i], 1);     dst[i] = (real_T)v; break; }
+            case MAT_MI_UINT8:  { uint8_T v;  memcpy(&v, &src[i], 1);     dst[i] = (real_T)v; break; }
+            case MAT_MI_INT16:  { int16_T v;  memcpy(&v, &src[i * 2], 2); dst[i] = (real_T)v; break; }
+            case MAT_MI_UINT16: { uint16_T v; memcpy(&v, &src[i * 2], 2); dst[i] = (real_T)v; break; }
+            case MAT_MI_INT32:  { int32_T v;  memcpy(&v, &src[i * 4], 4); dst[i] = (real_T)v; break; }
+            case MAT_MI_UINT32: { uint32_T v; memcpy(&v, &src[i * 4], 4); dst[i] = (real_T)v; break; }
+            case MAT_MI_SINGLE: { real32_T v; memcpy(&v, &src[i * 4], 4); dst[i] = (real_T)v; break; }
+            case MAT_MI_INT64:  { int64_t v;  memcpy(&v, &src[i * 8], 8); dst[i] = (real_T)v; break; }
+            case MAT_MI_UINT64: { uint64_t v; memcpy(&v, &src[i * 8], 8); dst[i] = (real_T)v; break; }
+            default:            { real_T v;   memcpy(&v, &src[i * 8], 8); dst[i] = v;         break; }
+        }
+    }
+}
+
+/**
+ * @brief 변수 색인 추가
+ */
+static boolean_T MAT_AddEntry(MAT_File_T* file, const MAT_Entry_T* entry)
+{
+    if (file->count == file->capacity) {
+        uint32_T capacity = (file->capacity > 0) ? file->capacity * 2 : 8;
+        MAT_Entry_T* entries = (MAT_Entry_T*)Mem_Realloc(NULL, file->entries, capacity * sizeof(MAT_Entry_T));
+        if (entries == NULL) {
+            return false;
+        }
+        file->entries = entries;
+        file->capacity = capacity;
+    }
+    file->entries[file->count++] = *entry;
+    return true;
+}
+
+/**
+ * @brief 파일 내용 매핑 (mmap이 없으면 전체 읽기)
+ */
+static boolean_T MAT_Map(MAT_File_T* file, const char* path)
+{
+#ifdef MAT_HAVE_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void* base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    file->base = (const uint8_T*)base;
+    file->size = (size_t)info.st_size;
+    return true;
+#else
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        size = ftell(fp);
+    }
+    uint8_T* base = (size > 0) ? (uint8_T*)Mem_Alloc(NULL, (size_t)size) : NULL;
+    if (base == NULL || fseek(fp, 0, SEEK_SET) != 0 ||
+        fread(base, 1, (size_t)size, fp) != (size_t)size) {
+        Mem_Free(NULL, base);
+        fclose(fp);
+        return false;
+    }
+    fclose(fp);
+
+    file->base = base;
+    file->size = (size_t)size;
+    return true;
+#endif
+}
+
+static void MAT_Unmap(MAT_File_T* file)
+{
+    if (file->base == NULL) {
+        return;
+    }
+#ifdef MAT_HAVE_MMAP
+    munmap((void*)file->base, file->size);
+#else
+    Mem_Free(NULL, (void*)file->base);
+#endif
+    file->base = NULL;
+}
+
+/**
+ * @brief MAT 파일 열기 및 변수 색인
+ */
+MAT_File_T* MAT_Open(const char* path)
+{
+    if (path == NULL) {
+        return NULL;
+    }
+
+    MAT_File_T* file = (MAT_File_T*)Mem_Calloc(NULL, 1, sizeof(MAT_File_T));
+    if (file == NULL) {
+        return NULL;
+    }
+    if (!MAT_Map(file, path)) {
+        Mem_Free(NULL, file);
+        return NULL;
+    }
+
+    /* 헤더: 텍스트 116 + 서브시스템 오프셋 8 + 버전 2 + 바이트 순서 표시 2 ("IM"이면 같은 순서) */
+    const uint8_T* header = file->base;
+    uint16_T version;
+    if (file->size < MAT_HEADER_SIZE) {
+        MAT_Close(file);
+        return NULL;
+    }
+    memcpy(&version, &header[124], sizeof(version));
+    if (version != 0x0100 || header[126] != 'I' || header[127] != 'M') {
+        MAT_Close(file);
+        return NULL;
+    }
+
+    /* 최상위 요소 색인 (압축 요소는 헤더 부분만 풀어서 이름 / 크기 확인) */
+    size_t offset = MAT_HEADER_SIZE;
+    while (offset + 8 <= file->size) {
+        uint32_T type = MAT_Load32(&file->base[offset]);
+        uint32_T bytes = MAT_Load32(&file->base[offset + 4]);
+        if ((size_t)bytes > file->size - offset - 8) {
+            break;  /* 잘린 파일 */
+        }
+
+        if (type == MAT_MI_MATRIX || type == MAT_MI_COMPRESSED) {
+            MAT_Entry_T entry;
+            MAT_Stream_T stream;
+            memset(&entry, 0, sizeof(MAT_Entry_T));
+            entry.element = &file->base[offset + 8];
+            entry.element_bytes = bytes;
+            entry.compressed = (boolean_T)(type == MAT_MI_COMPRESSED);
+
+            if (MAT_Stream_Open(&stream, &entry)) {
+                boolean_T parsed = MAT_ParseMatrix(&stream, &entry);
+                MAT_Stream_Close(&stream);
+                if (parsed && !MAT_AddEntry(file, &entry)) {
+                    MAT_Close(file);
+                    return NULL;
+                }
+            }
+        }
+
+        /* 압축 요소는 패딩 없음, 나머지는 8바이트 경계 */
+        offset += 8 + ((type == MAT_MI_COMPRESSED) ? (size_t)bytes : MAT_Pad8(bytes));
+    }
+
+    return file;
+}
+
+/**
+ * @brief MAT 파일 닫기
+ */
+void MAT_Close(MAT_File_T* file)
+{
+    if (file == NULL) {
+        return;
+    }
+
+    for (uint32_T i = 0; i < file->count; i++) {
+        Mem_Free(NULL, file->entries[i].buffer);
+    }
+    Mem_Free(NULL, file->entries);
+    MAT_Unmap(file);
+    Mem_Free(NULL, file);
+}
+
+/**
+ * @brief 색인된 변수 개수
+ */
+uint32_T MAT_GetVariableCount(const MAT_File_T* file)
+{
+    return (file != NULL) ? file->count : 0;
+}
+
+/**
+ * @brief 변수 이름
+ */
+const char* MAT_GetVariableName(const MAT_File_T* file, uint32_T index)
+{
+    if (file == NULL || index >= file->count) {
+        return NULL;
+    }
+    return file->entries[index].name;
+}
+
+/**
+ * @brief 변수 데이터 읽기 (압축 해제 / 변환)
+ */
+static boolean_T MAT_Load(MAT_Entry_T* entry)
+{
+    size_t count = entry->rows * entry->cols;
+    size_t type_size = MAT_TypeSize(entry->data_type);
+
+    /* 비압축 double이고 8바이트 정렬이면 매핑을 그대로 사용 */
+    MAT_Stream_T stream;
+    MAT_Entry_T header;
+    memset(&header, 0, sizeof(MAT_Entry_T));
+    header.element = entry->element;
+    header.element_bytes = entry->element_bytes;
+    header.compressed = entry->compressed;
+
+    if (!MAT_Stream_Open(&stream, &header)) {
+        return false;
+    }
+    if (!MAT_ParseMatrix(&stream, &header)) {
+        MAT_Stream_Close(&stream);
+        return false;
+    }
+
+    if (!entry->compressed && !entry->data_small && entry->data_type == MAT_MI_DOUBLE &&
+        ((uintptr_t)stream.next % sizeof(real_T)) == 0) {
+        entry->data = (const real_T*)stream.next;
+        MAT_Stream_Close(&stream);
+        return true;
+    }
+
+    real_T* buffer = (real_T*)Mem_Alloc(NULL, (count > 0 ? count : 1) * sizeof(real_T));
+    if (buffer == NULL) {
+        MAT_Stream_Close(&stream);
+        return false;
+    }
+
+    boolean_T success = true;
+    if (entry->data_small) {
+        MAT_Convert(entry->data_type, entry->small_data, count, buffer);
+    } else if (entry->data_type == MAT_MI_DOUBLE) {
+        /* double은 출력 버퍼에 직접 압축 해제 */
+        success = MAT_Stream_Read(&stream, buffer, count * sizeof(real_T));
+    } else {
+        /* 다른 형식은 청크 단위로 풀어서 변환 */
+        uint8_T chunk[MAT_CHUNK_SIZE];
+        size_t per_chunk = MAT_CHUNK_SIZE / type_size;
+        for (size_t done = 0; done < count && success; done += per_chunk) {
+            size_t n = (count - done < per_chunk) ? count - done : per_chunk;
+            success = MAT_Stream_Read(&stream, chunk, n * type_size);
+            if (success) {
+                MAT_Convert(entry->data_type, chunk, n, &buffer[done]);
+            }
+        }
+    }
+    MAT_Stream_Close(&stream);
+
+    if (!success) {
+        Mem_Free(NULL, buffer);
+        return false;
+    }
+    entry->buffer = buffer;
+    entry->data = buffer;
+    return true;
+}
+
+/**
+ * @brief 이름으로 실수 수치 배열 읽기
+ */
+boolean_T MAT_GetDouble(MAT_File_T* file, const char* name, MAT_Array_T* array)
+{
+    if (file == NULL || name == NULL || array == NULL) {
+        return false;
+    }
+
+    for (uint32_T i = 0; i < file->count; i++) {
+        MAT_Entry_T* entry = &file->entries[i];
+        if (strcmp(entry->name, name) != 0) {
+            continue;
+        }
+        if (!entry->numeric) {
+            return false;
+        }
+        if (entry->data == NULL && !MAT_Load(entry)) {
+            return false;
+        }
+
+        array->data = entry->data;
+        array->rows = entry->rows;
+        array->cols = entry->cols;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,280 @@
+/*
+ * socbin.c
+ *
+ * .socbin 측정 기록 형식 모듈 구현
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "socbin.h"
+#include "mem_account.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define SOCBIN_HAVE_MMAP  1
+#endif
+
+#define SOCBIN_COLUMNS             5
+
+/* 열 순서 (헤더 offset 인덱스) */
+enum {
+    SOCBIN_COLUMN_TIMESTAMP = 0,
+    SOCBIN_COLUMN_CURRENT,
+    SOCBIN_COLUMN_VOLTAGE,
+    SOCBIN_COLUMN_TEMPERATURE,
+    SOCBIN_COLUMN_CELL_ID
+};
+
+static const char SOCBIN_Magic[8] = { 'S', 'O', 'C', 'B', 'I', 'N', '\0', '\0' };
+
+/* 파일 헤더 (64바이트) */
+typedef struct {
+    char magic[8];
+    uint32_T version;
+    uint32_T flags;
+    uint64_t count;
+    uint64_t offset[SOCBIN_COLUMNS];
+} SOCBIN_Header_T;
+
+struct SOCBIN_File_T {
+    const uint8_T* base;           /* 파일 내용 (페이지 경계) */
+    size_t size;
+    void* allocation;              /* mmap이 없을 때 읽기 버퍼 */
+    SOCBIN_Columns_T columns;
+};
+
+static size_t SOCBIN_Align(size_t n)
+{
+    return (n + SOCBIN_ALIGNMENT - 1) & ~(size_t)(SOCBIN_ALIGNMENT - 1);
+}
+
+static size_t SOCBIN_ElementSize(int column)
+{
+    return (column == SOCBIN_COLUMN_CELL_ID) ? sizeof(uint32_T) : sizeof(real_T);
+}
+
+/**
+ * @brief .socbin 파일 쓰기
+ */
+boolean_T SOCBIN_Write(const char* path, const SOCBIN_Columns_T* columns)
+{
+    if (path == NULL || columns == NULL || columns->timestamp == NULL ||
+        columns->current == NULL || columns->voltage == NULL) {
+        return false;
+    }
+
+    const void* data[SOCBIN_COLUMNS] = {
+        columns->timestamp, columns->current, columns->voltage,
+        columns->temperature, columns->cell_id
+    };
+
+    SOCBIN_Header_T header;
+    memset(&header, 0, sizeof(SOCBIN_Header_T));
+    memcpy(header.magic, SOCBIN_Magic, sizeof(header.magic));
+    header.version = SOCBIN_VERSION;
+    header.count = (uint64_t)columns->count;
+    if (columns->temperature != NULL) {
+        header.flags |= SOCBIN_FLAG_TEMPERATURE;
+    }
+    if (columns->cell_id != NULL) {
+        header.flags |= SOCBIN_FLAG_CELL_ID;
+    }
+
+    size_t offset = SOCBIN_HEADER_SIZE;
+    for (int c = 0; c < SOCBIN_COLUMNS; c++) {
+        if (data[c] != NULL) {
+            header.offset[c] = (uint64_t)offset;
+            offset = SOCBIN_Align(offset + columns->count * SOCBIN_ElementSize(c));
+        }
+    }
+
+    FILE* fp = fopen(path, "wb");
+    if (fp == NULL) {
+        return false;
+    }
+
+    static const uint8_T padding[SOCBIN_ALIGNMENT] = { 0 };
+    boolean_T success = (boolean_T)(fwrite(&header, sizeof(header), 1, fp) == 1);
+    size_t written = SOCBIN_HEADER_SIZE;
+
+    for (int c = 0; c < SOCBIN_COLUMNS && success; c++) {
+        if (data[c] == NULL) {
+            continue;
+        }
+        size_t bytes = columns->count * SOCBIN_ElementSize(c);
+        size_t pad = (size_t)header.offset[c] - written;
+        success = (boolean_T)((pad == 0 || fwrite(padding, 1, pad, fp) == pad) &&
+                              (bytes == 0 || fwrite(data[c], 1, bytes, fp) == bytes));
+        written = (size_t)header.offset[c] + bytes;
+    }
+
+    if (fclose(fp) != 0) {
+        success = false;
+    }
+    return success;
+}
+
+/**
+ * @brief 파일 내용 매핑 (mmap이 없으면 정렬된 버퍼로 전체 읽기)
+ */
+static boolean_T SOCBIN_Map(SOCBIN_File_T* file, const char* path, uint32_T hints)
+{
+#ifdef SOCBIN_HAVE_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < SOCBIN_HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+
+    void* base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    /* 힌트는 성능용이므로 실패해도 무시 */
+    if ((hints & SOCBIN_HINT_SEQUENTIAL) != 0) {
+        madvise(base, (size_t)info.st_size, MADV_SEQUENTIAL);
+    }
+    if ((hints & SOCBIN_HINT_WILLNEED) != 0) {
+        madvise(base, (size_t)info.st_size, MADV_WILLNEED);
+    }
+#ifdef MADV_HUGEPAGE
+    if ((hints & SOCBIN_HINT_HUGEPAGE) != 0) {
+        madvise(base, (size_t)info.st_size, MADV_HUGEPAGE);
+    }
+#endif
+
+    file->base = (const uint8_T*)base;
+    file->size = (size_t)info.st_size;
+    return true;
+#else
+    (void)hints;
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL) {
+        return false;
+    }
+
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0) {
+        size = ftell(fp);
+    }
+    uint8_T* base = (size >= SOCBIN_HEADER_SIZE) ?
+                    (uint8_T*)Mem_AlignedAlloc(NULL, SOCBIN_ALIGNMENT, (size_t)size) : NULL;
+    if (base == NULL || fseek(fp, 0, SEEK_SET) != 0 ||
+        fread(base, 1, (size_t)size, fp) != (size_t)size) {
+        Mem_Free(NULL, base);
+        fclose(fp);
+        return false;
+    }
+    fclose(fp);
+
+    file->allocation = base;
+    file->base = base;
+    file->size = (size_t)size;
+    return true;
+#endif
+}
+
+/**
+ * @brief .socbin 파일 열기 (mmap)
+ */
+SOCBIN_File_T* SOCBIN_Open(const char* path, uint32_T hints)
+{
+    if (path == NULL) {
+        return NULL;
+    }
+
+    SOCBIN_File_T* file = (SOCBIN_File_T*)Mem_Calloc(NULL, 1, sizeof(SOCBIN_File_T));
+    if (file == NULL) {
+        return NULL;
+    }
+    if (!SOCBIN_Map(file, path, hints)) {
+        Mem_Free(NULL, file);
+        return NULL;
+    }
+
+    SOCBIN_Header_T header;
+    memcpy(&header, file->base, sizeof(header));
+    if (memcmp(header.magic, SOCBIN_Magic, sizeof(header.magic)) != 0 ||
+        header.version != SOCBIN_VERSION) {
+        SOCBIN_Close(file);
+        return NULL;
+    }
+
+    /* 열 범위 / 정렬 검증 */
+    const void* data[SOCBIN_COLUMNS] = { NULL, NULL, NULL, NULL, NULL };
+    for (int c = 0; c < SOCBIN_COLUMNS; c++) {
+        uint64_t offset = header.offset[c];
+        if (offset == 0) {
+            continue;
+        }
+        uint64_t bytes = header.count * (uint64_t)SOCBIN_ElementSize(c);
+        if ((offset % SOCBIN_ALIGNMENT) != 0 || offset < SOCBIN_HEADER_SIZE ||
+            offset > (uint64_t)file->size || bytes / SOCBIN_ElementSize(c) != header.count ||
+            bytes > (uint64_t)file->size - offset) {
+            SOCBIN_Close(file);
+            return NULL;
+        }
+        data[c] = &file->base[offset];
+    }
+    if (data[SOCBIN_COLUMN_TIMESTAMP] == NULL || data[SOCBIN_COLUMN_CURRENT] == NULL ||
+        data[SOCBIN_COLUMN_VOLTAGE] == NULL) {
+        SOCBIN_Close(file);
+        return NULL;
+    }
+
+    file->columns.timestamp = (const real_T*)data[SOCBIN_COLUMN_TIMESTAMP];
+    file->columns.current = (const real_T*)data[SOCBIN_COLUMN_CURRENT];
+    file->columns.voltage = (const real_T*)data[SOCBIN_COLUMN_VOLTAGE];
+    file->columns.temperature = (const real_T*)data[SOCBIN_COLUMN_TEMPERATURE];
+    file->columns.cell_id = (const uint32_T*)data[SOCBIN_COLUMN_CELL_ID];
+    file->columns.count = (size_t)header.count;
+    return file;
+}
+
+/**
+ * @brief .socbin 파일 닫기
+ */
+void SOCBIN_Close(SOCBIN_File_T* file)
+{
+    if (file == NULL) {
+        return;
+    }
+
+#ifdef SOCBIN_HAVE_MMAP
+    if (file->base != NULL) {
+        munmap((void*)file->base, file->size);
+    }
+#else
+    Mem_Free(NULL, file->allocation);
+#endif
+    Mem_Free(NULL, file);
+}
+
+/**
+ * @brief 열 포인터 얻기
+ */
+void SOCBIN_GetColumns(const SOCBIN_File_T* file, SOCBIN_Columns_T* columns)
+{
+    if (columns == NULL) {
+        return;
+    }
+    if (file == NULL) {
+        memset(columns, 0, sizeof(SOCBIN_Columns_T));
+        return;
+    }
+    *columns = file->columns;
+}
@@ -0,0 +1,96 @@
+/*
+ * trace_reader.c
+ *
+ * 측정 기록 열기 모듈 구현
+ */
+
+#include "trace_reader.h"
+#include <string.h>
+
+#define TRACE_SOCBIN_EXTENSION     ".socbin"
+
+boolean_T TRACE_IsSocbin(const char* path)
+{
+    if (path == NULL) {
+        return false;
+    }
+
+    size_t length = strlen(path);
+    size_t extension = sizeof(TRACE_SOCBIN_EXTENSION) - 1;
+    return length >= extension && strcmp(&path[length - extension], TRACE_SOCBIN_EXTENSION) == 0;
+}
+
+boolean_T TRACE_Open(const char* path, uint32_T hints, TRACE_Reader_T* trace)
+{
+    return TRACE_IsSocbin(path) ? TRACE_OpenSocbin(path, hints, trace) : TRACE_OpenMat(path, trace);
+}
+
+boolean_T TRACE_OpenMat(const char* path, TRACE_Reader_T* trace)
+{
+    if (trace == NULL) {
+        return false;
+    }
+    memset(trace, 0, sizeof(TRACE_Reader_T));
+    if (path == NULL) {
+        return false;
+    }
+
+    MAT_Array_T current;
+    MAT_Array_T voltage;
+    trace->mat = MAT_Open(path);
+    if (trace->mat == NULL || !MAT_GetDouble(trace->mat, TRACE_CURRENT_NAME, &current) ||
+        !MAT_GetDouble(trace->mat, TRACE_VOLTAGE_NAME, &voltage) ||
+        current.cols == 0 || voltage.cols == 0) {
+        TRACE_Close(trace);
+        return false;
+    }
+
+    trace->current = TRACE_ValueColumn(&current);
+    trace->voltage = TRACE_ValueColumn(&voltage);
+    trace->steps = (current.rows < voltage.rows) ? current.rows : voltage.rows;
+    return true;
+}
+
+boolean_T TRACE_OpenSocbin(const char* path, uint32_T hints, TRACE_Reader_T* trace)
+{
+    if (trace == NULL) {
+        return false;
+    }
+    memset(trace, 0, sizeof(TRACE_Reader_T));
+    if (path == NULL) {
+        return false;
+    }
+
+    trace->socbin = SOCBIN_Open(path, hints);
+    if (trace->socbin == NULL) {
+        return false;
+    }
+
+    SOCBIN_Columns_T columns;
+    SOCBIN_GetColumns(trace->socbin, &columns);
+    trace->current = columns.current;
+    trace->voltage = columns.voltage;
+    trace->steps = columns.count;
+    return true;
+}
+
+void TRACE_Close(TRACE_Reader_T* trace)
+{
+    if (trace == NULL) {
+        return;
+    }
+
+    MAT_Close(trace->mat);
+    SOCBIN_Close(trace->socbin);
+    memset(trace, 0, sizeof(TRACE_Reader_T));
+}
+
+const real_T* TRACE_ValueColumn(const MAT_Array_T* array)
+{
+    if (array == NULL || array->cols == 0) {
+        return NULL;
+    }
+
+    /* 열 우선 저장: 마지막 열이 값 */
+    return &array->data[(array->cols - 1) * array->rows];
+}
@@ -0,0 +1,486 @@
+/*
+ * cholesky.c
+ *
+ * SPD 선형 시스템 풀이 모듈 구현
+ * 일반 차원 코드를 항상 인라인되는 함수로 한 번만 작성하고,
+ * 고정 크기 특수화는 차원을 상수로 넘겨 컴파일러가 루프를 펼치도록 함
+ */
+
+#include "cholesky.h"
+#include "simd_lanes.h"
+#include <math.h>
+
+/* 상수 정의 */
+#define CHOLESKY_PIVOT_MIN     0.0     /* 피벗 하한 (이하이면 SPD가 아님) */
+
+/* 항상 인라인 지정 */
+#if defined(_MSC_VER)
+    #define CHOLESKY_INLINE    static __forceinline
+#else
+    #define CHOLESKY_INLINE    static inline __attribute__((always_inline))
+#endif
+
+/* 내부 함수: 차원 n에 대한 일반 구현 */
+
+CHOLESKY_INLINE boolean_T Cholesky_FactorN(real_T* A, const uint32_T n)
+{
+    for (uint32_T j = 0; j < n; j++) {
+        real_T* row_j = &A[j * n];
+        real_T d = row_j[j];
+
+        for (uint32_T k = 0; k < j; k++) {
+            d -= row_j[k] * row_j[k];
+        }
+
+        /* NaN도 실패로 처리 */
+        if (!(d > CHOLESKY_PIVOT_MIN)) {
+            return false;
+        }
+
+        real_T ljj = sqrt(d);
+        real_T inv = 1.0 / ljj;
+        row_j[j] = ljj;
+
+        for (uint32_T i = j + 1; i < n; i++) {
+            real_T* row_i = &A[i * n];
+            real_T s = row_i[j];
+
+            for (uint32_T k = 0; k < j; k++) {
+                s -= row_i[k] * row_j[k];
+            }
+            row_i[j] = s * inv;
+        }
+    }
+
+    return true;
+}
+
+CHOLESKY_INLINE void Cholesky_SolveN(const real_T* L, real_T* b, const uint32_T n)
+{
+    /* 전진 대입: L * y = b */
+    for (uint32_T i = 0; i < n; i++) {
+        real_T s = b[i];
+
+        for (uint32_T k = 0; k < i; k++) {
+            s -= L[i * n + k] * b[k];
+        }
+        b[i] = s / L[i * n + i];
+    }
+
+    /* 후진 대입: L^T * x = y */
+    for (uint32_T i = n; i-- > 0;) {
+        real_T s = b[i];
+
+        for (uint32_T k = i + 1; k < n; k++) {
+            s -= L[k * n + i] * b[k];
+        }
+        b[i] = s / L[i * n + i];
+    }
+}
+
+CHOLESKY_INLINE boolean_T LDLT_FactorN(real_T* A, const uint32_T n)
+{
+    real_T v[CHOLESKY_MAX_FIXED_DIM] = { 0.0 };
+
+    for (uint32_T j = 0; j < n; j++) {
+        real_T* row_j = &A[j * n];
+        real_T d = row_j[j];
+
+        /* v_k = L[j,k] * D[k] 를 한 번만 계산해 열 전체에 재사용 */
+        for (uint32_T k = 0; k < j; k++) {
+            v[k] = row_j[k] * A[k * n + k];
+            d -= row_j[k] * v[k];
+        }
+
+        if (!(d > CHOLESKY_PIVOT_MIN)) {
+            return false;
+        }
+
+        real_T inv = 1.0 / d;
+        row_j[j] = d;
+
+        for (uint32_T i = j + 1; i < n; i++) {
+            real_T* row_i = &A[i * n];
+            real_T s = row_i[j];
+
+            for (uint32_T k = 0; k < j; k++) {
+                s -= row_i[k] * v[k];
+            }
+            row_i[j] = s * inv;
+        }
+    }
+
+    return true;
+}
+
+CHOLESKY_INLINE void LDLT_SolveN(const real_T* LD, real_T* b, const uint32_T n)
+{
+    /* 전진 대입: L * z = b (단위 대각) */
+    for (uint32_T i = 0; i < n; i++) {
+        real_T s = b[i];
+
+        for (uint32_T k = 0; k < i; k++) {
+            s -= LD[i * n + k] * b[k];
+        }
+        b[i] = s;
+    }
+
+    /* 대각 스케일: D * y = z */
+    for (uint32_T i = 0; i < n; i++) {
+        b[i] /= LD[i * n + i];
+    }
+
+    /* 후진 대입: L^T * x = y */
+    for (uint32_T i = n; i-- > 0;) {
+        real_T s = b[i];
+
+        for (uint32_T k = i + 1; k < n; k++) {
+            s -= LD[k * n + i] * b[k];
+        }
+        b[i] = s;
+    }
+}
+
+/* 고정 크기 특수화 (n = 2 .. 8) */
+
+#define CHOLESKY_DEFINE_FIXED(N)                                    \
+    boolean_T Cholesky_Factor##N(real_T* A)                         \
+    {                                                               \
+        if (A == NULL) {                                            \
+            return false;                                           \
+        }                                                           \
+        return Cholesky_FactorN(A, N);                              \
+    }                                                               \
+    void Cholesky_Solve##N(const real_T* L, real_T* b)              \
+    {                                                               \
+        if (L == NULL || b == NULL) {                               \
+            return;                                                 \
+        }                                                           \
+        Cholesky_SolveN(L, b, N);                                   \
+    }                                                               \
+    boolean_T LDLT_Factor##N(real_T* A)                             \
+    {                                                               \
+        if (A == NULL) {                                            \
+            return false;                                           \
+        }                                                           \
+        return LDLT_FactorN(A, N);                                  \
+    }                                                               \
+    void LDLT_Solve##N(const real_T* LD, real_T* b)                 \
+    {                                                               \
+        if (LD == NULL || b == NULL) {                              \
+            return;                                                 \
+        }                                                           \
+        LDLT_SolveN(LD, b, N);                                      \
+    }
+
+CHOLESKY_DEFINE_FIXED(2)
+CHOLESKY_DEFINE_FIXED(3)
+CHOLESKY_DEFINE_FIXED(4)
+CHOLESKY_DEFINE_FIXED(5)
+CHOLESKY_DEFINE_FIXED(6)
+CHOLESKY_DEFINE_FIXED(7)
+CHOLESKY_DEFINE_FIXED(8)
+
+/* 일반 차원 함수 구현 */
+
+boolean_T Cholesky_Factor(real_T* A, uint32_T dim)
+{
+    if (A == NULL || dim == 0) {
+        return false;
+    }
+
+    switch (dim) {
+        case 2: return Cholesky_Factor2(A);
+        case 3: return Cholesky_Factor3(A);
+        case 4: return Cholesky_Factor4(A);
+        case 5: return Cholesky_Factor5(A);
+        case 6: return Cholesky_Factor6(A);
+        case 7: return Cholesky_Factor7(A);
+        case 8: return Cholesky_Factor8(A);
+        default: return Cholesky_FactorN(A, dim);
+    }
+}
+
+void Cholesky_Solve(const real_T* L, real_T* b, uint32_T dim)
+{
+    if (L == NULL || b == NULL) {
+        return;
+    }
+
+    switch (dim) {
+        case 2: Cholesky_Solve2(L, b); break;
+        case 3: Cholesky_Solve3(L, b); break;
+        case 4: Cholesky_Solve4(L, b); break;
+        case 5: Cholesky_Solve5(L, b); break;
+        case 6: Cholesky_Solve6(L, b); break;
+        case 7: Cholesky_Solve7(L, b); break;
+        case 8: Cholesky_Solve8(L, b); break;
+        default: Cholesky_SolveN(L, b, dim); break;
+    }
+}
+
+void Cholesky_SolveMatrix(const real_T* L, real_T* B, uint32_T dim, uint32_T nrhs)
+{
+    if (L == NULL || B == NULL) {
+        return;
+    }
+
+    /* 행 단위로 처리하여 B의 연속 메모리를 순차 접근 */
+
+    /* 전진 대입: L * Y = B */
+    for (uint32_T i = 0; i < dim; i++) {
+        real_T* row_i = &B[i * nrhs];
+
+        for (uint32_T k = 0; k < i; k++) {
+            const real_T lik = L[i * dim + k];
+            const real_T* row_k = &B[k * nrhs];
+
+            for (uint32_T c = 0; c < nrhs; c++) {
+                row_i[c] -= lik * row_k[c];
+            }
+        }
+
+        const real_T inv = 1.0 / L[i * dim + i];
+        for (uint32_T c = 0; c < nrhs; c++) {
+            row_i[c] *= inv;
+        }
+    }
+
+    /* 후진 대입: L^T * X = Y */
+    for (uint32_T i = dim; i-- > 0;) {
+        real_T* row_i = &B[i * nrhs];
+
+        for (uint32_T k = i + 1; k < dim; k++) {
+            const real_T lki = L[k * dim + i];
+            const real_T* row_k = &B[k * nrhs];
+
+            for (uint32_T c = 0; c < nrhs; c++) {
+                row_i[c] -= lki * row_k[c];
+            }
+        }
+
+        const real_T inv = 1.0 / L[i * dim + i];
+        for (uint32_T c = 0; c < nrhs; c++) {
+            row_i[c] *= inv;
+        }
+    }
+}
+
+void Cholesky_Inverse(const real_T* L, real_T* A_inv, uint32_T dim)
+{
+    if (L == NULL || A_inv == NULL) {
+        return;
+    }
+
+    for (uint32_T i = 0; i < dim; i++) {
+        for (uint32_T j = 0; j < dim; j++) {
+            A_inv[i * dim + j] = (i == j) ? 1.0 : 0.0;
+        }
+    }
+
+    Cholesky_SolveMatrix(L, A_inv, dim, dim);
+}
+
+boolean_T LDLT_Factor(real_T* A, uint32_T dim)
+{
+    if (A == NULL || dim == 0) {
+        return false;
+    }
+
+    switch (dim) {
+        case 2: return LDLT_Factor2(A);
+        case 3: return LDLT_Factor3(A);
+        case 4: return LDLT_Factor4(A);
+        case 5: return LDLT_Factor5(A);
+        case 6: return LDLT_Factor6(A);
+        case 7: return LDLT_Factor7(A);
+        case 8: return LDLT_Factor8(A);
+        default: break;
+    }
+
+    /* 큰 차원은 보조 벡터 없이 계산 (LDLT_FactorN의 v 버퍼는 8 고정) */
+    for (uint32_T j = 0; j < dim; j++) {
+        real_T* row_j = &A[j * dim];
+        real_T d = row_j[j];
+
+        for (uint32_T k = 0; k < j; k++) {
+            d -= row_j[k] * row_j[k] * A[k * dim + k];
+        }
+
+        if (!(d > CHOLESKY_PIVOT_MIN)) {
+            return false;
+        }
+
+        real_T inv = 1.0 / d;
+        row_j[j] = d;
+
+        for (uint32_T i = j + 1; i < dim; i++) {
+            real_T* row_i = &A[i * dim];
+            real_T s = row_i[j];
+
+            for (uint32_T k = 0; k < j; k++) {
+                s -= row_i[k] * row_j[k] * A[k * dim + k];
+            }
+            row_i[j] = s * inv;
+        }
+    }
+
+    return true;
+}
+
+void LDLT_Solve(const real_T* LD, real_T* b, uint32_T dim)
+{
+    if (LD == NULL || b == NULL) {
+        return;
+    }
+
+    switch (dim) {
+        case 2: LDLT_Solve2(LD, b); break;
+        case 3: LDLT_Solve3(LD, b); break;
+        case 4: LDLT_Solve4(LD, b); break;
+        case 5: LDLT_Solve5(LD, b); break;
+        case 6: LDLT_Solve6(LD, b); break;
+        case 7: LDLT_Solve7(LD, b); break;
+        case 8: LDLT_Solve8(LD, b); break;
+        default: LDLT_SolveN(LD, b, dim); break;
+    }
+}
+
+/* 배치 블록 커널: 레인 BATCH_LANES개, 요소 간 간격 s */
+
+/**
+ * @brief 블록 Cholesky 분해 (분기 없음)
+ * 양수가 아닌 피벗은 1로 대체하여 sqrt/나눗셈 예외 없이 진행하고 마스크만 기록
+ * @return 유효 레인 비트 마스크
+ */
+static int FactorBlock(real_T* A, uint32_T n, uint32_T s)
+{
+    const BatchVec_T one = BV_SET1(1.0);
+    const BatchVec_T pivot_min = BV_SET1(CHOLESKY_PIVOT_MIN);
+    int bits = (1 << BATCH_LANES) - 1;
+
+    for (uint32_T j = 0; j < n; j++) {
+        real_T* row_j = &A[j * n * s];
+        BatchVec_T d = BV_LOAD(&row_j[j * s]);
+
+        for (uint32_T k = 0; k < j; k++) {
+            BatchVec_T ljk = BV_LOAD(&row_j[k * s]);
+            d = BV_NMADD(ljk, ljk, d);
+        }
+
+        BatchVec_T pos = BV_CMPGT(d, pivot_min);
+        bits &= BV_MOVEMASK(pos);
+
+        BatchVec_T ljj = BV_SQRT(BV_SELECT(pos, d, one));
+        BatchVec_T inv = BV_DIV(one, ljj);
+        BV_STORE(&row_j[j * s], ljj);
+
+        for (uint32_T i = j + 1; i < n; i++) {
+            real_T* row_i = &A[i * n * s];
+            BatchVec_T acc = BV_LOAD(&row_i[j * s]);
+
+            for (uint32_T k = 0; k < j; k++) {
+                acc = BV_NMADD(BV_LOAD(&row_i[k * s]), BV_LOAD(&row_j[k * s]), acc);
+            }
+            BV_STORE(&row_i[j * s], BV_MUL(acc, inv));
+        }
+    }
+
+    return bits;
+}
+
+static void SolveBlock(const real_T* L, real_T* b, uint32_T n, uint32_T s)
+{
+    BatchVec_T x[CHOLESKY_MAX_FIXED_DIM];
+    BatchVec_T inv[CHOLESKY_MAX_FIXED_DIM];
+    const BatchVec_T one = BV_SET1(1.0);
+
+    for (uint32_T i = 0; i < n; i++) {
+        inv[i] = BV_DIV(one, BV_LOAD(&L[(i * n + i) * s]));
+    }
+
+    /* 전진 대입 */
+    for (uint32_T i = 0; i < n; i++) {
+        BatchVec_T acc = BV_LOAD(&b[i * s]);
+
+        for (uint32_T k = 0; k < i; k++) {
+            acc = BV_NMADD(BV_LOAD(&L[(i * n + k) * s]), x[k], acc);
+        }
+        x[i] = BV_MUL(acc, inv[i]);
+    }
+
+    /* 후진 대입 */
+    for (uint32_T i = n; i-- > 0;) {
+        BatchVec_T acc = x[i];
+
+        for (uint32_T k = i + 1; k < n; k++) {
+            acc = BV_NMADD(BV_LOAD(&L[(k * n + i) * s]), x[k], acc);
+        }
+        x[i] = BV_MUL(acc, inv[i]);
+        BV_STORE(&b[i * s], x[i]);
+    }
+}
+
+/* 배치 함수 구현 */
+
+uint32_T Cholesky_FactorBatch(real_T* A, boolean_T* valid, uint32_T dim, uint32_T count)
+{
+    if (A == NULL || count == 0) {
+        return 0;
+    }
+
+    if (dim == 0 || dim > CHOLESKY_MAX_FIXED_DIM) {
+        if (valid != NULL) {
+            for (uint32_T b = 0; b < count; b++) {
+                valid[b] = false;
+            }
+        }
+        return count;
+    }
+
+    const uint32_T elems = dim * dim;
+    uint32_T invalid = 0;
+    uint32_T b = 0;
+
+    for (; b + BATCH_LANES <= count; b += BATCH_LANES) {
+        int bits = FactorBlock(A + b, dim, count);
+        invalid += Batch_UnpackMask(bits, valid ? valid + b : NULL, BATCH_LANES);
+    }
+
+    if (b < count) {
+        real_T a_tail[CHOLESKY_MAX_FIXED_DIM * CHOLESKY_MAX_FIXED_DIM * BATCH_LANES];
+
+        /* 빈 레인은 0으로 채워 피벗 대체 경로를 타도록 함 (결과는 버림) */
+        Batch_PackTail(A, a_tail, elems, count, b, count - b, 0.0);
+        int bits = FactorBlock(a_tail, dim, BATCH_LANES);
+        invalid += Batch_UnpackMask(bits, valid ? valid + b : NULL, count - b);
+        Batch_UnpackTail(a_tail, A, elems, count, b, count - b);
+    }
+
+    return invalid;
+}
+
+void Cholesky_SolveBatch(const real_T* L, real_T* b, uint32_T dim, uint32_T count)
+{
+    if (L == NULL || b == NULL || count == 0 || dim == 0 || dim > CHOLESKY_MAX_FIXED_DIM) {
+        return;
+    }
+
+    const uint32_T elems = dim * dim;
+    uint32_T i = 0;
+
+    for (; i + BATCH_LANES <= count; i += BATCH_LANES) {
+        SolveBlock(L + i, b + i, dim, count);
+    }
+
+    if (i < count) {
+        real_T l_tail[CHOLESKY_MAX_FIXED_DIM * CHOLESKY_MAX_FIXED_DIM * BATCH_LANES];
+        real_T b_tail[CHOLESKY_MAX_FIXED_DIM * BATCH_LANES];
+
+        /* 빈 레인의 L은 1로 채워 0 나눗셈을 피함 */
+        Batch_PackTail(L, l_tail, elems, count, i, count - i, 1.0);
+        Batch_PackTail(b, b_tail, dim, count, i, count - i, 0.0);
+        SolveBlock(l_tail, b_tail, dim, BATCH_LANES);
+        Batch_UnpackTail(b_tail, b, dim, count, i, count - i);
+    }
+}
@@ -0,0 +1,312 @@
+/*
+ * matrix_batch.c
+ *
+ * 배치 소형 행렬 연산 모듈 구현
+ * SoA 배치에서 SIMD 레인 하나가 행렬 하나를 담당
+ */
+
+#include "matrix_batch.h"
+#include "matrix_ops.h"
+#include "simd_lanes.h"
+
+/* 상수 정의 */
+#define MATRIX_BATCH_EPSILON   1e-10   /* 역행렬 판정 기준 (matrix_ops와 동일) */
+
+/* 블록 커널 시그니처: 레인 BATCH_LANES개, 요소 간 간격 stride */
+typedef void (*BatchBinaryKernel_T)(const real_T* A, const real_T* B, real_T* C, uint32_T stride);
+typedef void (*BatchUnaryKernel_T)(const real_T* A, real_T* B, uint32_T stride);
+
+/* 내부 함수 */
+
+/**
+ * @brief 분기 없는 역행렬 스케일: |det| >= eps 이면 1/det, 아니면 0
+ * @param det 행렬식 벡터
+ * @param bits 출력: 유효 레인 비트 마스크
+ */
+static BatchVec_T Batch_SafeReciprocal(BatchVec_T det, int* bits)
+{
+    const BatchVec_T sign = BV_SET1(-0.0);
+    const BatchVec_T one = BV_SET1(1.0);
+    BatchVec_T mask = BV_CMPGE(BV_ANDNOT(sign, det), BV_SET1(MATRIX_BATCH_EPSILON));
+
+    /* 무효 레인은 1로 나누어 0 나눗셈 예외를 피한 뒤 마스크로 0 처리 */
+    BatchVec_T safe = BV_SELECT(mask, det, one);
+    *bits = BV_MOVEMASK(mask);
+    return BV_AND(mask, BV_DIV(one, safe));
+}
+
+/* 2x2 블록 커널 */
+
+static void Mul2x2Block(const real_T* A, const real_T* B, real_T* C, uint32_T s)
+{
+    BatchVec_T a0 = BV_LOAD(A), a1 = BV_LOAD(A + s), a2 = BV_LOAD(A + 2 * s), a3 = BV_LOAD(A + 3 * s);
+    BatchVec_T b0 = BV_LOAD(B), b1 = BV_LOAD(B + s), b2 = BV_LOAD(B + 2 * s), b3 = BV_LOAD(B + 3 * s);
+
+    BV_STORE(C,         BV_MADD(a1, b2, BV_MUL(a0, b0)));
+    BV_STORE(C + s,     BV_MADD(a1, b3, BV_MUL(a0, b1)));
+    BV_STORE(C + 2 * s, BV_MADD(a3, b2, BV_MUL(a2, b0)));
+    BV_STORE(C + 3 * s, BV_MADD(a3, b3, BV_MUL(a2, b1)));
+}
+
+static void Transpose2x2Block(const real_T* A, real_T* B, uint32_T s)
+{
+    BatchVec_T a0 = BV_LOAD(A), a1 = BV_LOAD(A + s), a2 = BV_LOAD(A + 2 * s), a3 = BV_LOAD(A + 3 * s);
+
+    BV_STORE(B,         a0);
+    BV_STORE(B + s,     a2);
+    BV_STORE(B + 2 * s, a1);
+    BV_STORE(B + 3 * s, a3);
+}
+
+static void Det2x2Block(const real_T* A, real_T* det, uint32_T s)
+{
+    BatchVec_T a0 = BV_LOAD(A), a1 = BV_LOAD(A + s), a2 = BV_LOAD(A + 2 * s), a3 = BV_LOAD(A + 3 * s);
+
+    BV_STORE(det, BV_DIFFPROD(a0, a3, a1, a2));
+}
+
+static int Inverse2x2Block(const real_T* A, real_T* B, uint32_T s)
+{
+    BatchVec_T a0 = BV_LOAD(A), a1 = BV_LOAD(A + s), a2 = BV_LOAD(A + 2 * s), a3 = BV_LOAD(A + 3 * s);
+    int bits;
+    BatchVec_T inv = Batch_SafeReciprocal(BV_DIFFPROD(a0, a3, a1, a2), &bits);
+    BatchVec_T neg = BV_SUB(BV_SET1(0.0), inv);
+
+    /* B = (1/det) * [a3, -a1; -a2, a0] */
+    BV_STORE(B,         BV_MUL(a3, inv));
+    BV_STORE(B + s,     BV_MUL(a1, neg));
+    BV_STORE(B + 2 * s, BV_MUL(a2, neg));
+    BV_STORE(B + 3 * s, BV_MUL(a0, inv));
+    return bits;
+}
+
+/* 3x3 블록 커널 */
+
+static void Mul3x3Block(const real_T* A, const real_T* B, real_T* C, uint32_T s)
+{
+    BatchVec_T a[MATRIX_3X3_SIZE], b[MATRIX_3X3_SIZE], c[MATRIX_3X3_SIZE];
+
+    for (int k = 0; k < MATRIX_3X3_SIZE; k++) {
+        a[k] = BV_LOAD(A + k * s);
+        b[k] = BV_LOAD(B + k * s);
+    }
+
+    /* C[i,j] = sum(A[i,k] * B[k,j]) for k = 0 to 2 */
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            BatchVec_T acc = BV_MUL(a[i * 3], b[j]);
+            acc = BV_MADD(a[i * 3 + 1], b[3 + j], acc);
+            c[i * 3 + j] = BV_MADD(a[i * 3 + 2], b[6 + j], acc);
+        }
+    }
+
+    for (int k = 0; k < MATRIX_3X3_SIZE; k++) {
+        BV_STORE(C + k * s, c[k]);
+    }
+}
+
+static void Transpose3x3Block(const real_T* A, real_T* B, uint32_T s)
+{
+    BatchVec_T a[MATRIX_3X3_SIZE];
+
+    for (int k = 0; k < MATRIX_3X3_SIZE; k++) {
+        a[k] = BV_LOAD(A + k * s);
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            BV_STORE(B + (j * 3 + i) * s, a[i * 3 + j]);
+        }
+    }
+}
+
+/* 여인수 첫 행으로 행렬식 계산: det = a0*c0 + a1*c1 + a2*c2 */
+static BatchVec_T Det3x3Vec(const BatchVec_T* a, BatchVec_T* c0, BatchVec_T* c1, BatchVec_T* c2)
+{
+    *c0 = BV_DIFFPROD(a[4], a[8], a[5], a[7]);
+    *c1 = BV_DIFFPROD(a[5], a[6], a[3], a[8]);
+    *c2 = BV_DIFFPROD(a[3], a[7], a[4], a[6]);
+    return BV_MADD(a[2], *c2, BV_MADD(a[1], *c1, BV_MUL(a[0], *c0)));
+}
+
+static void Det3x3Block(const real_T* A, real_T* det, uint32_T s)
+{
+    BatchVec_T a[MATRIX_3X3_SIZE], c0, c1, c2;
+
+    for (int k = 0; k < MATRIX_3X3_SIZE; k++) {
+        a[k] = BV_LOAD(A + k * s);
+    }
+    BV_STORE(det, Det3x3Vec(a, &c0, &c1, &c2));
+}
+
+static int Inverse3x3Block(const real_T* A, real_T* B, uint32_T s)
+{
+    BatchVec_T a[MATRIX_3X3_SIZE], c0, c1, c2;
+    int bits;
+
+    for (int k = 0; k < MATRIX_3X3_SIZE; k++) {
+        a[k] = BV_LOAD(A + k * s);
+    }
+
+    BatchVec_T inv = Batch_SafeReciprocal(Det3x3Vec(a, &c0, &c1, &c2), &bits);
+
+    /* 수반 행렬 계산 후 det로 나누기 (matrix_ops와 같은 식) */
+    BatchVec_T b1 = BV_DIFFPROD(a[2], a[7], a[1], a[8]);
+    BatchVec_T b2 = BV_DIFFPROD(a[1], a[5], a[2], a[4]);
+    BatchVec_T b4 = BV_DIFFPROD(a[0], a[8], a[2], a[6]);
+    BatchVec_T b5 = BV_DIFFPROD(a[2], a[3], a[0], a[5]);
+    BatchVec_T b7 = BV_DIFFPROD(a[1], a[6], a[0], a[7]);
+    BatchVec_T b8 = BV_DIFFPROD(a[0], a[4], a[1], a[3]);
+
+    BV_STORE(B,         BV_MUL(c0, inv));
+    BV_STORE(B + s,     BV_MUL(b1, inv));
+    BV_STORE(B + 2 * s, BV_MUL(b2, inv));
+    BV_STORE(B + 3 * s, BV_MUL(c1, inv));
+    BV_STORE(B + 4 * s, BV_MUL(b4, inv));
+    BV_STORE(B + 5 * s, BV_MUL(b5, inv));
+    BV_STORE(B + 6 * s, BV_MUL(c2, inv));
+    BV_STORE(B + 7 * s, BV_MUL(b7, inv));
+    BV_STORE(B + 8 * s, BV_MUL(b8, inv));
+    return bits;
+}
+
+static void Batch_RunBinary(BatchBinaryKernel_T kernel, uint32_T elems,
+                            const real_T* A, const real_T* B, real_T* C, uint32_T count)
+{
+    uint32_T b = 0;
+
+    for (; b + BATCH_LANES <= count; b += BATCH_LANES) {
+        kernel(A + b, B + b, C + b, count);
+    }
+
+    if (b < count) {
+        real_T a_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+        real_T b_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+        real_T c_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+
+        Batch_PackTail(A, a_tail, elems, count, b, count - b, 0.0);
+        Batch_PackTail(B, b_tail, elems, count, b, count - b, 0.0);
+        kernel(a_tail, b_tail, c_tail, BATCH_LANES);
+        Batch_UnpackTail(c_tail, C, elems, count, b, count - b);
+    }
+}
+
+static void Batch_RunUnary(BatchUnaryKernel_T kernel, uint32_T elems, uint32_T out_elems,
+                           const real_T* A, real_T* B, uint32_T count)
+{
+    uint32_T b = 0;
+
+    for (; b + BATCH_LANES <= count; b += BATCH_LANES) {
+        kernel(A + b, B + b, count);
+    }
+
+    if (b < count) {
+        real_T a_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+        real_T b_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+
+        Batch_PackTail(A, a_tail, elems, count, b, count - b, 0.0);
+        kernel(a_tail, b_tail, BATCH_LANES);
+        Batch_UnpackTail(b_tail, B, out_elems, count, b, count - b);
+    }
+}
+
+typedef int (*BatchInverseKernel_T)(const real_T* A, real_T* B, uint32_T stride);
+
+static uint32_T Batch_RunInverse(BatchInverseKernel_T kernel, uint32_T elems,
+                                 const real_T* A, real_T* B, boolean_T* valid, uint32_T count)
+{
+    uint32_T invalid = 0;
+    uint32_T b = 0;
+
+    for (; b + BATCH_LANES <= count; b += BATCH_LANES) {
+        int bits = kernel(A + b, B + b, count);
+        invalid += Batch_UnpackMask(bits, valid ? valid + b : NULL, BATCH_LANES);
+    }
+
+    if (b < count) {
+        real_T a_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+        real_T b_tail[MATRIX_3X3_SIZE * BATCH_LANES];
+
+        Batch_PackTail(A, a_tail, elems, count, b, count - b, 0.0);
+        int bits = kernel(a_tail, b_tail, BATCH_LANES);
+        invalid += Batch_UnpackMask(bits, valid ? valid + b : NULL, count - b);
+        Batch_UnpackTail(b_tail, B, elems, count, b, count - b);
+    }
+
+    return invalid;
+}
+
+/* 2x2 배치 연산 구현 */
+
+void Matrix2x2_MultiplyBatch(const real_T* A, const real_T* B, real_T* C, uint32_T count)
+{
+    if (A == NULL || B == NULL || C == NULL || count == 0) {
+        return;
+    }
+
+    Batch_RunBinary(Mul2x2Block, MATRIX_2X2_SIZE, A, B, C, count);
+}
+
+void Matrix2x2_TransposeBatch(const real_T* A, real_T* B, uint32_T count)
+{
+    if (A == NULL || B == NULL || count == 0) {
+        return;
+    }
+
+    Batch_RunUnary(Transpose2x2Block, MATRIX_2X2_SIZE, MATRIX_2X2_SIZE, A, B, count);
+}
+
+void Matrix2x2_DeterminantBatch(const real_T* A, real_T* det, uint32_T count)
+{
+    if (A == NULL || det == NULL || count == 0) {
+        return;
+    }
+
+    Batch_RunUnary(Det2x2Block, MATRIX_2X2_SIZE, 1, A, det, count);
+}
+
+uint32_T Matrix2x2_InverseBatch(const real_T* A, real_T* B, boolean_T* valid, uint32_T count)
+{
+    if (A == NULL || B == NULL || count == 0) {
+        return 0;
+    }
+
+    return Batch_RunInverse(Inverse2x2Block, MATRIX_2X2_SIZE, A, B, valid, count);
+}
+
+/* 3x3 배치 연산 구현 */
+
+void Matrix3x3_MultiplyBatch(const real_T* A, const real_T* B, real_T* C, uint32_T count)
+{
+    if (A == NULL || B == NULL || C == NULL || count == 0) {
+        return;
+    }
+
+    Batch_RunBinary(Mul3x3Block, MATRIX_3X3_SIZE, A, B, C, count);
+}
+
+void Matrix3x3_TransposeBatch(const real_T* A, real_T* B, uint32_T count)
+{
+    if (A == NULL || B == NULL || count == 0) {
+        return;
+    }
+
+    Batch_RunUnary(Transpose3x3Block, MATRIX_3X3_SIZE, MATRIX_3X3_SIZE, A, B, count);
+}
+
+void Matrix3x3_DeterminantBatch(const real_T* A, real_T* det, uint32_T count)
+{
+    if (A == NULL || det == NULL || count == 0) {
+        return;
+    }
+
+    Batch_RunUnary(Det3x3Block, MATRIX_3X3_SIZE, 1, A, det, count);
+}
+
+uint32_T Matrix3x3_InverseBatch(const real_T* A, real_T* B, boolean_T* valid, uint32_T count)
+{
+    if (A == NULL || B == NULL || count == 0) {
+        return 0;
+    }
+
+    return Batch_RunInverse(Inverse3x3Block, MATRIX_3X3_SIZE, A, B, valid, count);
+}
@@ -0,0 +1,209 @@
+/*
+ * matrix_ops_fixed.cpp
+ *
+ * 2x2, 3x3 행렬 연산 C ABI 구현
+ * small_matrix.hpp 템플릿 위에서 matrix_ops.h의 기존 Matrix2x2_* / Matrix3x3_*
+ * 시그니처를 그대로 제공하고, 융합 공분산 연산을 추가로 제공
+ */
+
+#include "matrix_ops.h"
+#include "small_matrix.hpp"
+#include <cstddef>
+#include <cmath>
+
+/* 상수 정의 */
+#define MATRIX_EPSILON       1e-10    /* 수치적 안정성을 위한 작은 값 */
+
+using soc::Map;
+using soc::Mat;
+
+typedef Map<2, 2> Map2x2;
+typedef Map<3, 3> Map3x3;
+
+/* 2x2 행렬 연산 구현 */
+
+void Matrix2x2_Multiply(const real_T* A, const real_T* B, real_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+    soc::Store(C, Map2x2(A) * Map2x2(B));
+}
+
+void Matrix2x2_Transpose(const real_T* A, real_T* B)
+{
+    if (A == NULL || B == NULL) {
+        return;
+    }
+
+    soc::Store(B, soc::Transpose(Map2x2(A)));
+}
+
+void Matrix2x2_Add(const real_T* A, const real_T* B, real_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+    soc::Store(C, Map2x2(A) + Map2x2(B));
+}
+
+void Matrix2x2_Subtract(const real_T* A, const real_T* B, real_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+    soc::Store(C, Map2x2(A) - Map2x2(B));
+}
+
+real_T Matrix2x2_Determinant(const real_T* A)
+{
+    if (A == NULL) {
+        return 0.0;
+    }
+
+    return soc::Determinant(Map2x2(A));
+}
+
+boolean_T Matrix2x2_Inverse(const real_T* A, real_T* B)
+{
+    if (A == NULL || B == NULL) {
+        return false;
+    }
+
+    real_T det = soc::Determinant(Map2x2(A));
+
+    /* 행렬식이 0이면 역행렬이 존재하지 않음 */
+    if (std::fabs(det) < MATRIX_EPSILON) {
+        return false;
+    }
+
+    soc::Store(B, soc::Adjugate(Map2x2(A)) * (1.0 / det));
+    return true;
+}
+
+void Matrix2x2_ScalarMultiply(const real_T* A, real_T k, real_T* B)
+{
+    if (A == NULL || B == NULL) {
+        return;
+    }
+
+    soc::Store(B, Map2x2(A) * k);
+}
+
+void Matrix2x2_CovariancePredict(const real_T* F, const real_T* P,
+                                 const real_T* Q, real_T* P_out)
+{
+    if (F == NULL || P == NULL || Q == NULL || P_out == NULL) {
+        return;
+    }
+
+    /* F*P는 레지스터 임시 행렬로 한 번만 평가되고, 나머지는 출력 원소별로 융합 */
+    soc::Store(P_out, Map2x2(F) * Map2x2(P) * soc::Transpose(Map2x2(F)) + Map2x2(Q));
+}
+
+void Matrix2x2_CovarianceUpdate(const real_T* K, const real_T* H,
+                                const real_T* P, real_T* P_out)
+{
+    if (K == NULL || H == NULL || P == NULL || P_out == NULL) {
+        return;
+    }
+
+    soc::Store(P_out, (soc::Identity<2>() - Map<2, 1>(K) * Map<1, 2>(H)) * Map2x2(P));
+}
+
+/* 3x3 행렬 연산 구현 */
+
+void Matrix3x3_Multiply(const real_T* A, const real_T* B, real_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+    soc::Store(C, Map3x3(A) * Map3x3(B));
+}
+
+void Matrix3x3_Transpose(const real_T* A, real_T* B)
+{
+    if (A == NULL || B == NULL) {
+        return;
+    }
+
+    soc::Store(B, soc::Transpose(Map3x3(A)));
+}
+
+void Matrix3x3_Add(const real_T* A, const real_T* B, real_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+    soc::Store(C, Map3x3(A) + Map3x3(B));
+}
+
+void Matrix3x3_Subtract(const real_T* A, const real_T* B, real_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+    soc::Store(C, Map3x3(A) - Map3x3(B));
+}
+
+real_T Matrix3x3_Determinant(const real_T* A)
+{
+    if (A == NULL) {
+        return 0.0;
+    }
+
+    return soc::Determinant(Map3x3(A));
+}
+
+boolean_T Matrix3x3_Inverse(const real_T* A, real_T* B)
+{
+    if (A == NULL || B == NULL) {
+        return false;
+    }
+
+    real_T det = soc::Determinant(Map3x3(A));
+
+    /* 행렬식이 0이면 역행렬이 존재하지 않음 */
+    if (std::fabs(det) < MATRIX_EPSILON) {
+        return false;
+    }
+
+    /* 수반 행렬 계산 후 det로 나누기 */
+    soc::Store(B, soc::Adjugate(Map3x3(A)) * (1.0 / det));
+    return true;
+}
+
+void Matrix3x3_ScalarMultiply(const real_T* A, real_T k, real_T* B)
+{
+    if (A == NULL || B == NULL) {
+        return;
+    }
+
+    soc::Store(B, Map3x3(A) * k);
+}
+
+void Matrix3x3_CovariancePredict(const real_T* F, const real_T* P,
+                                 const real_T* Q, real_T* P_out)
+{
+    if (F == NULL || P == NULL || Q == NULL || P_out == NULL) {
+        return;
+    }
+
+    soc::Store(P_out, Map3x3(F) * Map3x3(P) * soc::Transpose(Map3x3(F)) + Map3x3(Q));
+}
+
+void Matrix3x3_CovarianceUpdate(const real_T* K, const real_T* H,
+                                const real_T* P, real_T* P_out)
+{
+    if (K == NULL || H == NULL || P == NULL || P_out == NULL) {
+        return;
+    }
+
+    soc::Store(P_out, (soc::Identity<3>() - Map<3, 1>(K) * Map<1, 3>(H)) * Map3x3(P));
+}
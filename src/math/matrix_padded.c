@@ -0,0 +1,140 @@
+/*
+ * matrix_padded.c
+ *
+ * 패딩된 3x3 행렬 모듈 구현
+ * AVX 빌드에서는 한 행을 __m256d 하나로 처리 (4번째 레인은 0 유지)
+ * Matrix3x3_Padded_T는 32바이트 정렬을 요구하지 않으므로 비정렬 load / store 사용
+ * (32바이트 정렬된 주소에서는 정렬 명령과 같은 속도)
+ */
+
+#include "matrix_padded.h"
+#include <string.h>
+
+/* AVX 헤더 포함 */
+#ifdef _MSC_VER
+    #include <intrin.h>
+#elif defined(__AVX__)
+    #include <immintrin.h>
+#endif
+
+#define MATRIX_PADDED_ROWS  3       /* 행 개수 */
+
+#if defined(__AVX__)
+    #if defined(__FMA__)
+        #define PADDED_MADD(a, b, c)   _mm256_fmadd_pd((a), (b), (c))
+    #else
+        #define PADDED_MADD(a, b, c)   _mm256_add_pd(_mm256_mul_pd((a), (b)), (c))
+    #endif
+#endif
+
+void Matrix3x3_ToPadded(const real_T* A, Matrix3x3_Padded_T* P)
+{
+    if (A == NULL || P == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < MATRIX_PADDED_ROWS; i++) {
+        P->m[i * MATRIX_3X4_STRIDE + 0] = A[i * 3 + 0];
+        P->m[i * MATRIX_3X4_STRIDE + 1] = A[i * 3 + 1];
+        P->m[i * MATRIX_3X4_STRIDE + 2] = A[i * 3 + 2];
+        P->m[i * MATRIX_3X4_STRIDE + 3] = 0.0;  /* 패딩 레인 */
+    }
+}
+
+void Matrix3x3_FromPadded(const Matrix3x3_Padded_T* P, real_T* A)
+{
+    if (P == NULL || A == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < MATRIX_PADDED_ROWS; i++) {
+        A[i * 3 + 0] = P->m[i * MATRIX_3X4_STRIDE + 0];
+        A[i * 3 + 1] = P->m[i * MATRIX_3X4_STRIDE + 1];
+        A[i * 3 + 2] = P->m[i * MATRIX_3X4_STRIDE + 2];
+    }
+}
+
+void Matrix3x3_MultiplyPadded(const Matrix3x3_Padded_T* A, const Matrix3x3_Padded_T* B,
+                              Matrix3x3_Padded_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+#if defined(__AVX__)
+    /* C의 i행 = sum(A[i,k] * B의 k행): B의 패딩 레인이 0이므로 결과 패딩도 0 */
+    __m256d b0 = _mm256_loadu_pd(&B->m[0]);
+    __m256d b1 = _mm256_loadu_pd(&B->m[4]);
+    __m256d b2 = _mm256_loadu_pd(&B->m[8]);
+    __m256d c[MATRIX_PADDED_ROWS];
+
+    for (int i = 0; i < MATRIX_PADDED_ROWS; i++) {
+        const real_T* a = &A->m[i * MATRIX_3X4_STRIDE];
+        __m256d acc = _mm256_mul_pd(_mm256_broadcast_sd(&a[0]), b0);
+        acc = PADDED_MADD(_mm256_broadcast_sd(&a[1]), b1, acc);
+        c[i] = PADDED_MADD(_mm256_broadcast_sd(&a[2]), b2, acc);
+    }
+
+    _mm256_storeu_pd(&C->m[0], c[0]);
+    _mm256_storeu_pd(&C->m[4], c[1]);
+    _mm256_storeu_pd(&C->m[8], c[2]);
+#else
+    Matrix3x3_Padded_T tmp;
+
+    for (int i = 0; i < MATRIX_PADDED_ROWS; i++) {
+        for (int j = 0; j < MATRIX_3X4_STRIDE; j++) {
+            tmp.m[i * MATRIX_3X4_STRIDE + j] =
+                A->m[i * MATRIX_3X4_STRIDE + 0] * B->m[0 * MATRIX_3X4_STRIDE + j] +
+                A->m[i * MATRIX_3X4_STRIDE + 1] * B->m[1 * MATRIX_3X4_STRIDE + j] +
+                A->m[i * MATRIX_3X4_STRIDE + 2] * B->m[2 * MATRIX_3X4_STRIDE + j];
+        }
+    }
+    memcpy(C, &tmp, sizeof(tmp));
+#endif
+}
+
+void Matrix3x3_AddPadded(const Matrix3x3_Padded_T* A, const Matrix3x3_Padded_T* B,
+                         Matrix3x3_Padded_T* C)
+{
+    if (A == NULL || B == NULL || C == NULL) {
+        return;
+    }
+
+#if defined(__AVX__)
+    for (int i = 0; i < MATRIX_3X4_SIZE; i += MATRIX_3X4_STRIDE) {
+        _mm256_storeu_pd(&C->m[i], _mm256_add_pd(_mm256_loadu_pd(&A->m[i]),
+                                                _mm256_loadu_pd(&B->m[i])));
+    }
+#else
+    for (int i = 0; i < MATRIX_3X4_SIZE; i++) {
+        C->m[i] = A->m[i] + B->m[i];
+    }
+#endif
+}
+
+void Matrix3x3_Rank1UpdatePadded(const Matrix3x3_Padded_T* A, real_T alpha,
+                                 const real_T* u, const real_T* v,
+                                 Matrix3x3_Padded_T* C)
+{
+    if (A == NULL || u == NULL || v == NULL || C == NULL) {
+        return;
+    }
+
+#if defined(__AVX__)
+    /* v의 패딩 레인을 0으로 두어 결과의 패딩 레인이 유지되도록 함 */
+    __m256d vt = _mm256_set_pd(0.0, alpha * v[2], alpha * v[1], alpha * v[0]);
+
+    for (int i = 0; i < MATRIX_PADDED_ROWS; i++) {
+        __m256d row = _mm256_loadu_pd(&A->m[i * MATRIX_3X4_STRIDE]);
+        _mm256_storeu_pd(&C->m[i * MATRIX_3X4_STRIDE],
+                        PADDED_MADD(_mm256_set1_pd(u[i]), vt, row));
+    }
+#else
+    for (int i = 0; i < MATRIX_PADDED_ROWS; i++) {
+        for (int j = 0; j < 3; j++) {
+            C->m[i * MATRIX_3X4_STRIDE + j] = A->m[i * MATRIX_3X4_STRIDE + j] + alpha * u[i] * v[j];
+        }
+        C->m[i * MATRIX_3X4_STRIDE + 3] = 0.0;
+    }
+#endif
+}
@@ -0,0 +1,117 @@
+/*
+ * simd_lanes.h
+ *
+ * 배치 커널 내부용 SIMD 레인 매크로 (비공개 헤더)
+ * 빌드 대상에 따라 AVX (4 레인) 또는 SSE2 (2 레인)로 확장되어,
+ * 한 레인이 하나의 행렬/시스템을 담당하는 SoA 배치 커널을 한 번만 작성하게 함
+ */
+
+#ifndef SIMD_LANES_H
+#define SIMD_LANES_H
+
+#include "rtwtypes.h"
+#include <string.h>
+
+/* SIMD 헤더 포함 */
+#ifdef _MSC_VER
+    #include <intrin.h>
+#elif defined(__AVX__)
+    #include <immintrin.h>
+#else
+    #include <emmintrin.h>
+#endif
+
+/* 레인 폭에 독립적인 벡터 연산 매크로 */
+#if defined(__AVX__)
+    typedef __m256d BatchVec_T;
+    #define BATCH_LANES            4
+    #define BV_LOAD(p)             _mm256_loadu_pd(p)
+    #define BV_STORE(p, v)         _mm256_storeu_pd((p), (v))
+    #define BV_SET1(x)             _mm256_set1_pd(x)
+    #define BV_ADD(a, b)           _mm256_add_pd((a), (b))
+    #define BV_SUB(a, b)           _mm256_sub_pd((a), (b))
+    #define BV_MUL(a, b)           _mm256_mul_pd((a), (b))
+    #define BV_DIV(a, b)           _mm256_div_pd((a), (b))
+    #define BV_SQRT(a)             _mm256_sqrt_pd(a)
+    #define BV_AND(a, b)           _mm256_and_pd((a), (b))
+    #define BV_ANDNOT(a, b)        _mm256_andnot_pd((a), (b))
+    #define BV_OR(a, b)            _mm256_or_pd((a), (b))
+    #define BV_CMPGE(a, b)         _mm256_cmp_pd((a), (b), _CMP_GE_OQ)
+    #define BV_CMPGT(a, b)         _mm256_cmp_pd((a), (b), _CMP_GT_OQ)
+    #define BV_MOVEMASK(a)         _mm256_movemask_pd(a)
+    #if defined(__FMA__)
+        #define BV_MADD(a, b, c)   _mm256_fmadd_pd((a), (b), (c))
+        #define BV_MSUB(a, b, c)   _mm256_fmsub_pd((a), (b), (c))
+        #define BV_NMADD(a, b, c)  _mm256_fnmadd_pd((a), (b), (c))
+    #endif
+#else
+    typedef __m128d BatchVec_T;
+    #define BATCH_LANES            2
+    #define BV_LOAD(p)             _mm_loadu_pd(p)
+    #define BV_STORE(p, v)         _mm_storeu_pd((p), (v))
+    #define BV_SET1(x)             _mm_set1_pd(x)
+    #define BV_ADD(a, b)           _mm_add_pd((a), (b))
+    #define BV_SUB(a, b)           _mm_sub_pd((a), (b))
+    #define BV_MUL(a, b)           _mm_mul_pd((a), (b))
+    #define BV_DIV(a, b)           _mm_div_pd((a), (b))
+    #define BV_SQRT(a)             _mm_sqrt_pd(a)
+    #define BV_AND(a, b)           _mm_and_pd((a), (b))
+    #define BV_ANDNOT(a, b)        _mm_andnot_pd((a), (b))
+    #define BV_OR(a, b)            _mm_or_pd((a), (b))
+    #define BV_CMPGE(a, b)         _mm_cmpge_pd((a), (b))
+    #define BV_CMPGT(a, b)         _mm_cmpgt_pd((a), (b))
+    #define BV_MOVEMASK(a)         _mm_movemask_pd(a)
+#endif
+
+#ifndef BV_MADD
+    #define BV_MADD(a, b, c)       BV_ADD(BV_MUL((a), (b)), (c))
+    #define BV_MSUB(a, b, c)       BV_SUB(BV_MUL((a), (b)), (c))
+    #define BV_NMADD(a, b, c)      BV_SUB((c), BV_MUL((a), (b)))
+#endif
+
+/* a*b - c*d */
+#define BV_DIFFPROD(a, b, c, d)    BV_MSUB((a), (b), BV_MUL((c), (d)))
+
+/* 마스크 선택: mask ? a : b */
+#define BV_SELECT(mask, a, b)      BV_OR(BV_AND((mask), (a)), BV_ANDNOT((mask), (b)))
+
+/* 배치 공통 보조 함수 */
+
+/**
+ * @brief 유효 비트 마스크를 boolean 배열로 풀고 무효 개수 반환
+ */
+static inline uint32_T Batch_UnpackMask(int bits, boolean_T* valid, uint32_T lanes)
+{
+    uint32_T invalid = 0;
+
+    for (uint32_T l = 0; l < lanes; l++) {
+        boolean_T ok = (boolean_T)((bits >> l) & 1);
+        if (valid != NULL) {
+            valid[l] = ok;
+        }
+        invalid += (uint32_T)(ok ^ 1);
+    }
+    return invalid;
+}
+
+/* 나머지 레인 처리: 레인 폭 임시 버퍼에 모아 같은 커널 사용 */
+
+static inline void Batch_PackTail(const real_T* src, real_T* dst, uint32_T elems,
+                                  uint32_T count, uint32_T offset, uint32_T tail, real_T pad)
+{
+    for (uint32_T k = 0; k < elems; k++) {
+        for (uint32_T l = 0; l < BATCH_LANES; l++) {
+            dst[k * BATCH_LANES + l] = (l < tail) ? src[k * count + offset + l] : pad;
+        }
+    }
+}
+
+static inline void Batch_UnpackTail(const real_T* src, real_T* dst, uint32_T elems,
+                                    uint32_T count, uint32_T offset, uint32_T tail)
+{
+    for (uint32_T k = 0; k < elems; k++) {
+        memcpy(&dst[k * count + offset], &src[k * BATCH_LANES], tail * sizeof(real_T));
+    }
+}
+
+#endif /* SIMD_LANES_H */
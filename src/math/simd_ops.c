@@ -336,6 +336,48 @@ real_T SIMD_VectorDotProduct8(const real_T* A, const real_T* B)
     return SIMD_VectorDotProduct4(A, B) + SIMD_VectorDotProduct4(A + 4, B + 4);
 }
 
+/* 임의 길이 벡터 연산 */
+
+real_T SIMD_VectorSum(const real_T* A, size_t n)
+{
+    if (A == NULL) {
+        return 0.0;
+    }
+    
+    size_t i = 0;
+    real_T sum = 0.0;
+    
+    if (SIMD_IsSupported()) {
+        /* 4개 누산기 x 2 레인: 한 번에 8개 double */
+        __m128d acc0 = _mm_setzero_pd();
+        __m128d acc1 = _mm_setzero_pd();
+        __m128d acc2 = _mm_setzero_pd();
+        __m128d acc3 = _mm_setzero_pd();
+        
+        for (; i + 8 <= n; i += 8) {
+            acc0 = _mm_add_pd(acc0, _mm_loadu_pd(&A[i]));
+            acc1 = _mm_add_pd(acc1, _mm_loadu_pd(&A[i + 2]));
+            acc2 = _mm_add_pd(acc2, _mm_loadu_pd(&A[i + 4]));
+            acc3 = _mm_add_pd(acc3, _mm_loadu_pd(&A[i + 6]));
+        }
+        for (; i + 2 <= n; i += 2) {
+            acc0 = _mm_add_pd(acc0, _mm_loadu_pd(&A[i]));
+        }
+        
+        __m128d acc = _mm_add_pd(_mm_add_pd(acc0, acc1), _mm_add_pd(acc2, acc3));
+        real_T result[2];
+        _mm_storeu_pd(result, acc);
+        sum = result[0] + result[1];
+    }
+    
+    /* 나머지 요소 */
+    for (; i < n; i++) {
+        sum += A[i];
+    }
+    
+    return sum;
+}
+
 /* 기타 벡터 연산 */
 
 real_T SIMD_VectorMax2(const real_T* A)
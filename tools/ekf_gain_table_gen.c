@@ -0,0 +1,89 @@
+/*
+ * ekf_gain_table_gen.c
+ *
+ * EKF 게인 테이블 생성 도구 (오프라인)
+ * SoCesti 모델의 SoC 격자(pooled5)에 대해 주어진 Q/R에서 EKF_Update와 같은 측정 모델로
+ * 수렴한 정상 상태 칼만 게인을 계산하여 C 소스로 출력
+ *
+ * 사용법:
+ *   ekf_gain_table_gen [Q_soc Q_error R dt capacity] > ekf_gain_table_data.c
+ *
+ * 출력된 배열(ekf_gain_table.h의 EKF_GainTableData_*)을 함께 링크하고
+ * EKF_GainTable_Initialize로 테이블을 만든 뒤 SoC_Cell_Config_T.ekf_gain_table
+ * (또는 EKF_SetGainSchedule)로 EKF에 연결하여 사용
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/ekf.h"
+#include "core/ekf_gain_table.h"
+
+/* 기존 코드의 상수 테이블 */
+#include "../rtwtypes.h"
+#include "../SoCesti.h"
+
+/* 상수 정의 (main.c의 기본 EKF 설정과 동일) */
+#define GAIN_TABLE_POINTS          201     /* SoC 격자점 개수 */
+#define DEFAULT_Q_SOC              1e-9    /* SoC 프로세스 노이즈 */
+#define DEFAULT_Q_ERROR            1.0     /* 전압 오차 프로세스 노이즈 */
+#define DEFAULT_R                  0.1     /* 측정 노이즈 분산 */
+#define DEFAULT_SAMPLING_TIME      1.0     /* 샘플링 시간 (초) */
+#define DEFAULT_BATTERY_CAPACITY   2.0     /* 배터리 용량 (Ah) */
+
+static void PrintArray(const char* name, const real_T* data, uint32_T n)
+{
+    printf("const real_T %s[%u] = {\n", name, (unsigned)n);
+    for (uint32_T i = 0; i < n; i++) {
+        printf("    %.17g%s\n", data[i], (i + 1 < n) ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+int main(int argc, char* argv[])
+{
+    EKF_Params_T params;
+    params.Q[0] = DEFAULT_Q_SOC;
+    params.Q[1] = 0.0;
+    params.Q[2] = 0.0;
+    params.Q[3] = DEFAULT_Q_ERROR;
+    params.R = DEFAULT_R;
+    params.dt = DEFAULT_SAMPLING_TIME;
+    params.capacity = DEFAULT_BATTERY_CAPACITY;
+
+    if (argc == 6) {
+        params.Q[0] = atof(argv[1]);
+        params.Q[3] = atof(argv[2]);
+        params.R = atof(argv[3]);
+        params.dt = atof(argv[4]);
+        params.capacity = atof(argv[5]);
+    } else if (argc != 1) {
+        fprintf(stderr, "사용법: %s [Q_soc Q_error R dt capacity]\n", argv[0]);
+        return 1;
+    }
+
+    real_T gain_soc[GAIN_TABLE_POINTS];
+    real_T gain_error[GAIN_TABLE_POINTS];
+
+    uint32_T failed = EKF_GainTable_Compute(&params, SoCesti_ConstP.pooled5,
+                                            GAIN_TABLE_POINTS, gain_soc, gain_error);
+    if (failed > 0) {
+        fprintf(stderr, "경고: %u개 격자점에서 게인이 수렴하지 않음\n", (unsigned)failed);
+    }
+
+    printf("/*\n");
+    printf(" * ekf_gain_table_data.c\n");
+    printf(" *\n");
+    printf(" * ekf_gain_table_gen으로 생성된 정상 상태 칼만 게인 테이블\n");
+    printf(" * Q = diag(%g, %g), R = %g, dt = %g s, capacity = %g Ah\n",
+           params.Q[0], params.Q[3], params.R, params.dt, params.capacity);
+    printf(" */\n\n");
+    printf("#include \"core/ekf_gain_table.h\"\n\n");
+    printf("const uint32_T EKF_GainTableData_Points = %u;\n\n", (unsigned)GAIN_TABLE_POINTS);
+
+    PrintArray("EKF_GainTableData_Soc", SoCesti_ConstP.pooled5, GAIN_TABLE_POINTS);
+    PrintArray("EKF_GainTableData_GainSoc", gain_soc, GAIN_TABLE_POINTS);
+    PrintArray("EKF_GainTableData_GainError", gain_error, GAIN_TABLE_POINTS);
+
+    return (failed > 0) ? 1 : 0;
+}
@@ -0,0 +1,185 @@
+/*
+ * ekf_smoother_bench.c
+ *
+ * EKF 스무더 벤치마크 도구 (오프라인)
+ * 기록 길이별로 순방향 필터와 체크포인트 RTS 스무더의 실행 시간,
+ * 스무더 작업 메모리(체크포인트 + 구간 버퍼)와 전체 저장 방식의 메모리를 비교하고,
+ * 여러 기록을 스레드 수별로 일괄 평활하여 처리량을 출력
+ *
+ * EKF 파라미터는 main.c의 기본 셀 설정(SoC_System_GetDefaultConfig)을 사용하며,
+ * ekf_gain_table_gen과 같은 순서의 Q_soc Q_error R dt capacity 5개 인자로 바꿀 수 있음
+ *
+ * 사용법:
+ *   ekf_smoother_bench [max_length [traces [Q_soc Q_error R dt capacity]]]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "core/ekf.h"
+#include "core/ekf_smoother.h"
+#include "core/soc_cell.h"
+
+#include "../rtwtypes.h"
+
+/* 상수 정의 */
+#define DEFAULT_MAX_LENGTH         1000000 /* 최대 기록 길이 */
+#define DEFAULT_TRACES             16      /* 일괄 평활 기록 개수 */
+#define BATCH_LENGTH               100000  /* 일괄 평활 기록 길이 */
+
+/* main.c의 기본 셀 설정 (BENCH 빌드에서는 main() 없이 링크) */
+extern void SoC_System_GetDefaultConfig(SoC_Cell_Config_T* config);
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* 합성 기록: 펄스 방전 전류와 잡음 섞인 전압 */
+static void MakeTrace(real_T* voltage, real_T* current, size_t n, unsigned seed)
+{
+    srand(seed);
+    for (size_t k = 0; k < n; k++) {
+        current[k] = ((k / 600) % 2 == 0) ? 1.0 : 0.0;
+        voltage[k] = 3.7 - 0.5 * (real_T)k / (real_T)n + 0.01 * ((real_T)rand() / RAND_MAX - 0.5);
+    }
+}
+
+/* 싱크: 평활 SoC 합 (출력 저장 없이 결과 소비) */
+static void SumSink(void* context, size_t k, const EKF_State_T* state, const real_T* P)
+{
+    (void)k;
+    (void)P;
+    *(real_T*)context += state->soc;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t max_length = DEFAULT_MAX_LENGTH;
+    uint32_T traces = DEFAULT_TRACES;
+
+    if (argc >= 2) {
+        max_length = (size_t)atol(argv[1]);
+    }
+    if (argc >= 3) {
+        traces = (uint32_T)atoi(argv[2]);
+    }
+    if ((argc > 3 && argc != 8) || max_length == 0 || traces == 0) {
+        fprintf(stderr, "사용법: %s [max_length [traces [Q_soc Q_error R dt capacity]]]\n", argv[0]);
+        return 1;
+    }
+
+    SoC_Cell_Config_T config;
+    SoC_System_GetDefaultConfig(&config);
+    EKF_Params_T params = config.ekf;
+    if (argc == 8) {
+        params.Q[0] = atof(argv[3]);
+        params.Q[3] = atof(argv[4]);
+        params.R = atof(argv[5]);
+        params.dt = atof(argv[6]);
+        params.capacity = atof(argv[7]);
+    }
+    printf("# Q = diag(%g, %g), R = %g, dt = %g s, capacity = %g Ah\n",
+           params.Q[0], params.Q[3], params.R, params.dt, params.capacity);
+
+    EKF_T ekf;
+    if (!EKF_Initialize(&ekf, &params)) {
+        fprintf(stderr, "EKF 초기화 실패\n");
+        return 1;
+    }
+
+    size_t batch_length = (BATCH_LENGTH < max_length) ? BATCH_LENGTH : max_length;
+    size_t buffer_length = (max_length > batch_length * traces) ? max_length : batch_length * traces;
+    real_T* voltage = (real_T*)malloc(buffer_length * sizeof(real_T));
+    real_T* current = (real_T*)malloc(buffer_length * sizeof(real_T));
+    if (voltage == NULL || current == NULL) {
+        fprintf(stderr, "메모리 부족\n");
+        free(voltage);
+        free(current);
+        return 1;
+    }
+
+    /* 길이별 실행 시간 / 메모리 */
+    printf("%10s %12s %12s %8s %14s %14s\n",
+           "length", "filter(ms)", "smooth(ms)", "ratio", "workspace(B)", "full(B)");
+
+    for (size_t n = 1000; n <= max_length; n *= 10) {
+        MakeTrace(voltage, current, n, 1u);
+
+        EKF_T filter = ekf;
+        double t0 = Now();
+        for (size_t k = 0; k < n; k++) {
+            EKF_Step(&filter, voltage[k], current[k], params.dt);
+        }
+        double t1 = Now();
+
+        real_T sum = 0.0;
+        if (!EKF_Smooth(&ekf, voltage, current, n, params.dt, SumSink, &sum)) {
+            fprintf(stderr, "평활 실패 (n = %zu)\n", n);
+            break;
+        }
+        double t2 = Now();
+
+        /* 전체 저장: 스텝별 필터 상태(2) + 공분산(4) */
+        size_t full = n * 6 * sizeof(real_T);
+        printf("%10zu %12.2f %12.2f %8.2f %14zu %14zu\n",
+               n, (t1 - t0) * 1e3, (t2 - t1) * 1e3, (t2 - t1) / (t1 - t0),
+               EKF_Smoother_WorkspaceSize(n), full);
+    }
+
+    /* 기록 단위 병렬 일괄 평활 */
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_T max_threads = (online > 0) ? (uint32_T)online : 1;
+
+    EKF_Smoother_Trace_T* batch = (EKF_Smoother_Trace_T*)malloc(traces * sizeof(EKF_Smoother_Trace_T));
+    real_T* sums = (real_T*)malloc(traces * sizeof(real_T));
+    if (batch == NULL || sums == NULL) {
+        fprintf(stderr, "메모리 부족\n");
+        free(batch);
+        free(sums);
+        free(voltage);
+        free(current);
+        return 1;
+    }
+
+    for (uint32_T i = 0; i < traces; i++) {
+        MakeTrace(&voltage[i * batch_length], &current[i * batch_length], batch_length, i + 1u);
+        batch[i].voltage = &voltage[i * batch_length];
+        batch[i].current = &current[i * batch_length];
+        batch[i].n = batch_length;
+        batch[i].sink = SumSink;
+        batch[i].context = &sums[i];
+    }
+
+    printf("\n%u개 기록 x %zu 스텝 일괄 평활\n", (unsigned)traces, batch_length);
+    printf("%8s %12s %14s\n", "threads", "time(ms)", "steps/s");
+
+    for (uint32_T threads = 1; threads <= max_threads; threads *= 2) {
+        for (uint32_T i = 0; i < traces; i++) {
+            sums[i] = 0.0;
+        }
+
+        double t0 = Now();
+        uint32_T succeeded = EKF_SmoothBatch(&ekf, batch, traces, params.dt, threads);
+        double t1 = Now();
+
+        if (succeeded != traces) {
+            fprintf(stderr, "평활 실패: %u / %u\n", (unsigned)(traces - succeeded), (unsigned)traces);
+        }
+        printf("%8u %12.2f %14.3e\n", (unsigned)threads, (t1 - t0) * 1e3,
+               (double)traces * (double)batch_length / (t1 - t0));
+    }
+
+    free(batch);
+    free(sums);
+    free(voltage);
+    free(current);
+    return 0;
+}
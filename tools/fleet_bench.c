@@ -0,0 +1,662 @@
+/*
+ * fleet_bench.c
+ *
+ * 플릿 규모 확장 벤치마크 (make fleet)
+ * 셀 수(1 ~ 10^7, 10진 구간마다 1 / 2 / 5)와 스레드 수(1, 2, 4, .., CPU 수)를 바꿔 가며
+ * 셀마다 시간 이동한 WSN9 기록을 재생하고, 셀 상태가 L1 / L2 / LLC를 넘어설 때의
+ * 처리량(cell-steps/s), 셀당 메모리, LLC 미스 변화를 측정
+ *
+ * 실행 방식 (엔진):
+ * - instance: 샘플 주기마다 모든 셀을 한 스텝씩 실행 (온라인 BMS 틱과 같은 순서).
+ *   틱마다 플릿 전체 상태를 한 번씩 훑으므로 상태가 캐시를 넘으면 스텝마다 미스
+ * - batch: 셀마다 입력 FLEET_BLOCK개를 모아 연속으로 실행한 뒤 다음 셀로 이동
+ *   (샘플을 묶어 전달받는 게이트웨이 / 오프라인 재처리 순서). 셀 상태를 한 번 불러와
+ *   FLEET_BLOCK 스텝 동안 재사용
+ * 두 엔진 모두 같은 SoC_Cell_Step을 호출하므로 결과 SoC는 같고 접근 순서만 다름
+ *
+ * 기록: 셀 i는 전체 기록 길이 N에서 (i * 황금비 * N) mod N 위치부터 재생 (원형)
+ * 메모리: 셀 구조체 + 할당 계정(SoC_Cell_GetMemory)의 힙 바이트, 그리고 셀 초기화 전후
+ *         RSS 차이. 사용 가능 메모리의 FLEET_MEMORY_FRACTION을 넘는 셀 수는 건너뜀
+ * 꺾이는 점 (엔진별, 1 스레드 기준):
+ * - throughput: 처리량이 그보다 작은 플릿 최대값의 FLEET_KNEE_THROUGHPUT 아래로 처음 떨어진 셀 수
+ * - llc_miss: cell-step당 LLC 미스가 FLEET_KNEE_LLC 이상이 된 첫 셀 수 (SOC_PERF=1, 카운터 필요)
+ * - predicted: 캐시 크기 / 셀당 상태 바이트
+ *
+ * 사용법:
+ *   fleet_bench [trace.mat|trace.socbin [max_cells [output_prefix [cell_steps]]]]
+ *   (output_prefix를 주면 <prefix>.csv / <prefix>.json, 아니면 CSV를 표준 출력으로.
+ *    cell_steps는 측정점당 목표 스텝 수, 진행 상황은 표준 오류)
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+    #define FLEET_HAVE_THREADS  1
+#endif
+
+#include "core/soc_cell.h"
+#include "core/mem_account.h"
+#include "core/perf_counters.h"
+#include "io/trace_reader.h"
+
+#include "../rtwtypes.h"
+
+/* 상수 정의 */
+#define DEFAULT_TRACE              "WSN9.mat"
+#define DEFAULT_MAX_CELLS          10000000
+#define DEFAULT_CELL_STEPS         1e7     /* 측정점당 목표 cell-step 수 */
+#define FLEET_BLOCK                64      /* batch 엔진 블록 길이 (샘플) */
+#define FLEET_MAX_THREADS          256
+#define FLEET_MAX_POINTS           32      /* 셀 수 측정점 최대 개수 */
+#define FLEET_MEMORY_FRACTION      0.5     /* 사용할 수 있는 최대 메모리 (MemAvailable 비율) */
+#define FLEET_ALLOCATOR_OVERHEAD   16      /* malloc 블록당 추정 오버헤드 (바이트) */
+#define FLEET_KNEE_THROUGHPUT      0.8     /* 처리량 꺾임 판정 비율 */
+#define FLEET_KNEE_LLC             0.5     /* LLC 꺾임 판정 (cell-step당 미스) */
+#define FLEET_SHIFT                0.6180339887498949  /* 셀 간 시간 이동 (황금비) */
+
+/* main.c의 기본 셀 설정 (BENCH 빌드에서는 main() 없이 링크) */
+extern void SoC_System_GetDefaultConfig(SoC_Cell_Config_T* config);
+
+/* 실행 방식 */
+typedef enum {
+    ENGINE_INSTANCE = 0,
+    ENGINE_BATCH,
+    ENGINES
+} Fleet_Engine_T;
+
+static const char* const g_engine_names[ENGINES] = { "instance", "batch" };
+
+/* 작업 스레드 입력 / 출력 */
+typedef struct {
+    SoC_Cell_T* cells;
+    const uint32_T* offsets;       /* 셀별 기록 시작 위치 */
+    const TRACE_Reader_T* trace;
+    size_t first;                  /* 담당 셀 범위 */
+    size_t count;
+    size_t start;                  /* 기록 내 시작 틱 (0 .. N-1) */
+    size_t ticks;                  /* 실행할 틱 수 */
+    Fleet_Engine_T engine;
+    int cpu;                       /* 고정할 CPU (-1이면 고정 안 함) */
+    real_T sink;                   /* SoC 합 (결과 소비) */
+} Fleet_Worker_T;
+
+/* 측정점 결과 */
+typedef struct {
+    Fleet_Engine_T engine;
+    uint32_T threads;
+    size_t cells;
+    size_t ticks;
+    double seconds;
+    double cell_steps_per_s;
+    double rss_per_cell;           /* 셀 초기화 전후 RSS 차이 / 셀 수 (바이트) */
+    Perf_Sample_T counters;
+} Fleet_Point_T;
+
+/* 하드웨어 카운터 (SOC_PERF=1일 때만 열림) */
+static Perf_Counters_T g_perf;
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ========================================================================
+ * 시스템 정보
+ * ======================================================================== */
+
+/* /proc/meminfo의 MemAvailable (바이트, 읽지 못하면 0) */
+static size_t MemoryAvailable(void)
+{
+    char line[256];
+    unsigned long long kb = 0;
+    FILE* fp = fopen("/proc/meminfo", "r");
+    if (fp == NULL) {
+        return 0;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        if (sscanf(line, "MemAvailable: %llu kB", &kb) == 1) {
+            break;
+        }
+    }
+    fclose(fp);
+    return (size_t)kb * 1024u;
+}
+
+/* 현재 RSS (바이트, 읽지 못하면 0) */
+static size_t ResidentBytes(void)
+{
+    unsigned long long pages = 0;
+    unsigned long long resident = 0;
+    FILE* fp = fopen("/proc/self/statm", "r");
+    if (fp == NULL) {
+        return 0;
+    }
+    if (fscanf(fp, "%llu %llu", &pages, &resident) != 2) {
+        resident = 0;
+    }
+    fclose(fp);
+    return (size_t)resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+/* 캐시 크기 (level 1 = L1D, 2, 3; 알 수 없으면 0) */
+static size_t CacheSize(int level)
+{
+    long size = 0;
+#if defined(_SC_LEVEL1_DCACHE_SIZE)
+    size = sysconf((level == 1) ? _SC_LEVEL1_DCACHE_SIZE :
+                   (level == 2) ? _SC_LEVEL2_CACHE_SIZE : _SC_LEVEL3_CACHE_SIZE);
+#endif
+    if (size > 0) {
+        return (size_t)size;
+    }
+
+    /* sysfs: index0..N 중 level / 종류가 맞는 항목 */
+    for (int index = 0; index < 8; index++) {
+        char path[128];
+        char text[64];
+        int cache_level = 0;
+        unsigned long long kb = 0;
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+        FILE* fp = fopen(path, "r");
+        if (fp == NULL) {
+            break;
+        }
+        if (fscanf(fp, "%d", &cache_level) != 1) {
+            cache_level = 0;
+        }
+        fclose(fp);
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+        fp = fopen(path, "r");
+        text[0] = '\0';
+        if (fp != NULL) {
+            if (fscanf(fp, "%63s", text) != 1) {
+                text[0] = '\0';
+            }
+            fclose(fp);
+        }
+        if (cache_level != level || strcmp(text, "Instruction") == 0) {
+            continue;
+        }
+
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+        fp = fopen(path, "r");
+        if (fp != NULL) {
+            if (fscanf(fp, "%lluK", &kb) != 1) {
+                kb = 0;
+            }
+            fclose(fp);
+        }
+        return (size_t)kb * 1024u;
+    }
+    return 0;
+}
+
+/* ========================================================================
+ * 실행
+ * ======================================================================== */
+
+/* 담당 셀 범위를 ticks 틱 동안 실행 */
+static void* Fleet_Run(void* argument)
+{
+    Fleet_Worker_T* worker = (Fleet_Worker_T*)argument;
+    const real_T* current = worker->trace->current;
+    const real_T* voltage = worker->trace->voltage;
+    size_t n = worker->trace->steps;
+    size_t last = worker->first + worker->count;
+    real_T sink = 0.0;
+
+#ifdef FLEET_HAVE_THREADS
+    if (worker->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(worker->cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#endif
+
+    if (worker->engine == ENGINE_INSTANCE) {
+        size_t k = worker->start;
+        for (size_t t = 0; t < worker->ticks; t++) {
+            for (size_t i = worker->first; i < last; i++) {
+                size_t index = worker->offsets[i] + k;
+                index = (index >= n) ? index - n : index;
+                sink += SoC_Cell_Step(&worker->cells[i], current[index], voltage[index]);
+            }
+            k = (k + 1 < n) ? k + 1 : 0;
+        }
+    } else {
+        size_t k = worker->start;
+        for (size_t t = 0; t < worker->ticks; t += FLEET_BLOCK) {
+            size_t block = (worker->ticks - t < FLEET_BLOCK) ? worker->ticks - t : FLEET_BLOCK;
+            for (size_t i = worker->first; i < last; i++) {
+                size_t index = worker->offsets[i] + k;
+                index = (index >= n) ? index - n : index;
+                for (size_t b = 0; b < block; b++) {
+                    sink += SoC_Cell_Step(&worker->cells[i], current[index], voltage[index]);
+                    index = (index + 1 < n) ? index + 1 : 0;
+                }
+            }
+            k = (k + block) % n;
+        }
+    }
+
+    worker->sink = sink;
+    return NULL;
+}
+
+/**
+ * @brief 셀 cells개를 threads개 스레드로 나눠 ticks 틱 실행하고 경과 시간 반환
+ */
+static double Fleet_Measure(SoC_Cell_T* cells, const uint32_T* offsets, const TRACE_Reader_T* trace,
+                            size_t cell_count, uint32_T threads, size_t start, size_t ticks,
+                            Fleet_Engine_T engine, Perf_Sample_T* counters, real_T* sink)
+{
+    Fleet_Worker_T workers[FLEET_MAX_THREADS];
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (uint32_T t = 0; t < threads; t++) {
+        workers[t].cells = cells;
+        workers[t].offsets = offsets;
+        workers[t].trace = trace;
+        workers[t].first = cell_count * t / threads;
+        workers[t].count = cell_count * (t + 1) / threads - workers[t].first;
+        workers[t].start = start;
+        workers[t].ticks = ticks;
+        workers[t].engine = engine;
+        workers[t].cpu = (online > 0) ? (int)(t % (uint32_T)online) : -1;
+        workers[t].sink = 0.0;
+    }
+
+    Perf_Start(&g_perf);
+    double t0 = Now();
+#ifdef FLEET_HAVE_THREADS
+    pthread_t handles[FLEET_MAX_THREADS];
+    uint32_T started = 0;
+    for (uint32_T t = 1; t < threads; t++) {
+        if (pthread_create(&handles[t], NULL, Fleet_Run, &workers[t]) != 0) {
+            break;
+        }
+        started = t;
+    }
+    Fleet_Run(&workers[0]);
+    for (uint32_T t = 1; t <= started; t++) {
+        pthread_join(handles[t], NULL);
+    }
+    /* 만들지 못한 스레드 몫은 호출 스레드가 실행 */
+    for (uint32_T t = started + 1; t < threads; t++) {
+        Fleet_Run(&workers[t]);
+    }
+#else
+    for (uint32_T t = 0; t < threads; t++) {
+        Fleet_Run(&workers[t]);
+    }
+#endif
+    double elapsed = Now() - t0;
+    Perf_Stop(&g_perf, counters);
+
+    for (uint32_T t = 0; t < threads; t++) {
+        *sink += workers[t].sink;
+    }
+    return elapsed;
+}
+
+/* ========================================================================
+ * 출력
+ * ======================================================================== */
+
+static void PrintCsvValue(FILE* out, real_T value, const char* format)
+{
+    fputc(',', out);
+    if (value >= 0.0) {
+        fprintf(out, format, value);
+    }
+}
+
+static void PrintCsvHeader(FILE* out)
+{
+    fprintf(out, "engine,threads,cells,ticks,cell_steps,seconds,cell_steps_per_s,ns_per_cell_step,"
+                 "state_bytes_per_cell,rss_bytes_per_cell,footprint_bytes,"
+                 "ipc,l1d_misses_per_step,llc_misses_per_step,branch_misses_per_step\n");
+}
+
+static void PrintCsvRow(FILE* out, const Fleet_Point_T* point, size_t state_bytes)
+{
+    real_T steps = (real_T)point->cells * (real_T)point->ticks;
+
+    fprintf(out, "%s,%u,%zu,%zu,%.0f,%.6f,%.1f,%.3f,%zu,%.1f,%zu", g_engine_names[point->engine],
+            (unsigned)point->threads, point->cells, point->ticks, steps, point->seconds,
+            point->cell_steps_per_s, (point->cell_steps_per_s > 0.0) ? 1e9 / point->cell_steps_per_s : 0.0,
+            state_bytes, point->rss_per_cell, state_bytes * point->cells);
+    PrintCsvValue(out, Perf_GetIPC(&point->counters), "%.3f");
+    PrintCsvValue(out, Perf_GetPerUnit(&point->counters, PERF_L1D_MISSES, steps), "%.4f");
+    PrintCsvValue(out, Perf_GetPerUnit(&point->counters, PERF_LLC_MISSES, steps), "%.5f");
+    PrintCsvValue(out, Perf_GetPerUnit(&point->counters, PERF_BRANCH_MISSES, steps), "%.4f");
+    fputc('\n', out);
+}
+
+static void PrintJsonSize(FILE* out, const char* name, size_t value, boolean_T last)
+{
+    if (value > 0) {
+        fprintf(out, "\"%s\": %zu%s", name, value, last ? "" : ", ");
+    } else {
+        fprintf(out, "\"%s\": null%s", name, last ? "" : ", ");
+    }
+}
+
+/* 엔진별 꺾이는 점 (1 스레드 측정점 기준, 찾지 못하면 0) */
+static void FindKnees(const Fleet_Point_T* points, size_t count, Fleet_Engine_T engine,
+                      size_t* throughput_knee, size_t* llc_knee)
+{
+    double peak = 0.0;
+    *throughput_knee = 0;
+    *llc_knee = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const Fleet_Point_T* p = &points[i];
+        if (p->engine != engine || p->threads != 1) {
+            continue;
+        }
+        if (*throughput_knee == 0 && peak > 0.0 && p->cell_steps_per_s < FLEET_KNEE_THROUGHPUT * peak) {
+            *throughput_knee = p->cells;
+        }
+        if (p->cell_steps_per_s > peak) {
+            peak = p->cell_steps_per_s;
+        }
+
+        real_T llc = Perf_GetPerUnit(&p->counters, PERF_LLC_MISSES, (real_T)p->cells * (real_T)p->ticks);
+        if (*llc_knee == 0 && llc >= FLEET_KNEE_LLC) {
+            *llc_knee = p->cells;
+        }
+    }
+}
+
+static boolean_T WriteJson(const char* path, const char* trace_path, const TRACE_Reader_T* trace,
+                           const Fleet_Point_T* points, size_t count, size_t max_cells, size_t run_cells,
+                           size_t state_bytes, const Mem_Account_T* heap, const size_t caches[3])
+{
+    FILE* out = fopen(path, "w");
+    if (out == NULL) {
+        return false;
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"trace\": \"%s\",\n", trace_path);
+    fprintf(out, "  \"trace_steps\": %zu,\n", trace->steps);
+    fprintf(out, "  \"block\": %d,\n", FLEET_BLOCK);
+    fprintf(out, "  \"max_cells_requested\": %zu,\n", max_cells);
+    fprintf(out, "  \"max_cells_run\": %zu,\n", run_cells);
+    fprintf(out, "  \"hardware_counters\": \"%s\",\n",
+            Perf_Requested() ? Perf_Describe(&g_perf) : "off (SOC_PERF=1)");
+    fprintf(out, "  \"caches\": {");
+    PrintJsonSize(out, "l1d_bytes", caches[0], false);
+    PrintJsonSize(out, "l2_bytes", caches[1], false);
+    PrintJsonSize(out, "llc_bytes", caches[2], true);
+    fprintf(out, "},\n");
+    fprintf(out, "  \"memory_per_cell\": {\"state_bytes\": %zu, \"struct_bytes\": %zu, "
+                 "\"heap_bytes\": %zu, \"heap_allocations\": %u},\n",
+            state_bytes, sizeof(SoC_Cell_T), heap->bytes, (unsigned)heap->allocations);
+
+    fprintf(out, "  \"knees\": {\n");
+    for (int e = 0; e < ENGINES; e++) {
+        size_t throughput_knee;
+        size_t llc_knee;
+        FindKnees(points, count, (Fleet_Engine_T)e, &throughput_knee, &llc_knee);
+        fprintf(out, "    \"%s\": {", g_engine_names[e]);
+        PrintJsonSize(out, "throughput_cells", throughput_knee, false);
+        PrintJsonSize(out, "llc_miss_cells", llc_knee, false);
+        PrintJsonSize(out, "predicted_l1d_cells", caches[0] / state_bytes, false);
+        PrintJsonSize(out, "predicted_l2_cells", caches[1] / state_bytes, false);
+        PrintJsonSize(out, "predicted_llc_cells", caches[2] / state_bytes, true);
+        fprintf(out, "}%s\n", (e + 1 < ENGINES) ? "," : "");
+    }
+    fprintf(out, "  },\n");
+
+    fprintf(out, "  \"points\": [\n");
+    for (size_t i = 0; i < count; i++) {
+        const Fleet_Point_T* p = &points[i];
+        real_T steps = (real_T)p->cells * (real_T)p->ticks;
+        fprintf(out, "    {\"engine\": \"%s\", \"threads\": %u, \"cells\": %zu, \"ticks\": %zu, "
+                     "\"seconds\": %.6f, \"cell_steps_per_s\": %.1f, \"rss_bytes_per_cell\": %.1f, "
+                     "\"counters\": ",
+                g_engine_names[p->engine], (unsigned)p->threads, p->cells, p->ticks, p->seconds,
+                p->cell_steps_per_s, p->rss_per_cell);
+        if (g_perf.opened > 0) {
+            Perf_PrintJson(out, &p->counters, steps);
+        } else {
+            fprintf(out, "null");
+        }
+        fprintf(out, "}%s\n", (i + 1 < count) ? "," : "");
+    }
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+
+    return (boolean_T)(fclose(out) == 0);
+}
+
+/* ========================================================================
+ * 메인
+ * ======================================================================== */
+
+int main(int argc, char* argv[])
+{
+    const char* path = (argc >= 2) ? argv[1] : DEFAULT_TRACE;
+    double max_request = (argc >= 3) ? atof(argv[2]) : (double)DEFAULT_MAX_CELLS;
+    const char* prefix = (argc >= 4) ? argv[3] : NULL;
+    double budget = (argc >= 5) ? atof(argv[4]) : DEFAULT_CELL_STEPS;
+
+    if (argc > 5 || !(max_request >= 1.0) || !(budget >= 1.0)) {
+        fprintf(stderr, "사용법: %s [trace.mat|trace.socbin [max_cells [output_prefix [cell_steps]]]]\n",
+                argv[0]);
+        return 1;
+    }
+    size_t max_cells = (size_t)max_request;
+
+    TRACE_Reader_T trace;
+    if (!TRACE_Open(path, SOCBIN_HINT_WILLNEED, &trace) || trace.steps == 0) {
+        fprintf(stderr, "기록을 열 수 없음: %s\n", path);
+        return 1;
+    }
+
+    /* 셀 하나의 메모리: 구조체 + 할당 계정 */
+    SoC_Cell_Config_T config;
+    SoC_System_GetDefaultConfig(&config);
+
+    SoC_Cell_T probe;
+    Mem_Account_T heap;
+    if (!SoC_Cell_Initialize(&probe, &config)) {
+        fprintf(stderr, "셀 초기화 실패\n");
+        TRACE_Close(&trace);
+        return 1;
+    }
+    SoC_Cell_GetMemory(&probe, &heap);
+    SoC_Cell_Cleanup(&probe);
+
+    size_t state_bytes = sizeof(SoC_Cell_T) + heap.bytes;
+    size_t estimate = state_bytes + heap.allocations * (MEM_HEADER_SIZE + FLEET_ALLOCATOR_OVERHEAD);
+    size_t available = MemoryAvailable();
+    size_t run_cells = max_cells;
+    if (available > 0 && (double)run_cells * (double)estimate > FLEET_MEMORY_FRACTION * (double)available) {
+        run_cells = (size_t)(FLEET_MEMORY_FRACTION * (double)available / (double)estimate);
+    }
+
+    /* 측정점: 10진 구간마다 1 / 2 / 5 */
+    size_t counts[FLEET_MAX_POINTS];
+    size_t point_count = 0;
+    for (size_t decade = 1; decade <= run_cells && point_count < FLEET_MAX_POINTS; decade *= 10) {
+        static const size_t steps[] = { 1, 2, 5 };
+        for (size_t s = 0; s < 3 && point_count < FLEET_MAX_POINTS; s++) {
+            if (decade * steps[s] <= run_cells) {
+                counts[point_count++] = decade * steps[s];
+            }
+        }
+        if (decade > run_cells / 10) {
+            break;
+        }
+    }
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_T max_threads = (online > 0) ? (uint32_T)online : 1;
+    if (max_threads > FLEET_MAX_THREADS) {
+        max_threads = FLEET_MAX_THREADS;
+    }
+#ifndef FLEET_HAVE_THREADS
+    max_threads = 1;
+#endif
+
+    /* 스레드 수: 1, 2, 4, .. 와 CPU 수 */
+    uint32_T thread_counts[FLEET_MAX_POINTS];
+    size_t thread_steps = 0;
+    for (uint32_T threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts[thread_steps++] = threads;
+    }
+    thread_counts[thread_steps++] = max_threads;
+
+    size_t caches[3] = { CacheSize(1), CacheSize(2), CacheSize(3) };
+    if (Perf_Requested()) {
+        Perf_Open(&g_perf);
+    }
+
+    fprintf(stderr, "# %s: %zu 스텝, 셀당 %zu 바이트 (구조체 %zu + 힙 %zu, 할당 %u회)\n", path, trace.steps,
+            state_bytes, sizeof(SoC_Cell_T), heap.bytes, (unsigned)heap.allocations);
+    fprintf(stderr, "# 캐시 L1D %zu / L2 %zu / LLC %zu 바이트, CPU %u개\n", caches[0], caches[1], caches[2],
+            (unsigned)max_threads);
+    if (run_cells < max_cells) {
+        fprintf(stderr, "# 최대 셀 수 %zu -> %zu (사용 가능 메모리 %zu MB의 %.0f%%, 셀당 약 %zu 바이트)\n",
+                max_cells, run_cells, available >> 20, FLEET_MEMORY_FRACTION * 100.0, estimate);
+    }
+    if (Perf_Requested()) {
+        fprintf(stderr, "# 하드웨어 카운터: %s\n", Perf_Describe(&g_perf));
+    }
+
+    SoC_Cell_T* cells = (SoC_Cell_T*)malloc(run_cells * sizeof(SoC_Cell_T));
+    uint32_T* offsets = (uint32_T*)malloc(run_cells * sizeof(uint32_T));
+    Fleet_Point_T* points = (Fleet_Point_T*)calloc(point_count * ENGINES * thread_steps, sizeof(Fleet_Point_T));
+    if (cells == NULL || offsets == NULL || points == NULL) {
+        fprintf(stderr, "메모리 부족\n");
+        free(cells);
+        free(offsets);
+        free(points);
+        Perf_Close(&g_perf);
+        TRACE_Close(&trace);
+        return 1;
+    }
+
+    FILE* csv = stdout;
+    char csv_path[1024];
+    char json_path[1024];
+    if (prefix != NULL) {
+        snprintf(csv_path, sizeof(csv_path), "%s.csv", prefix);
+        snprintf(json_path, sizeof(json_path), "%s.json", prefix);
+        csv = fopen(csv_path, "w");
+        if (csv == NULL) {
+            fprintf(stderr, "출력 파일을 열 수 없음: %s\n", csv_path);
+            free(cells);
+            free(offsets);
+            free(points);
+            Perf_Close(&g_perf);
+            TRACE_Close(&trace);
+            return 1;
+        }
+    }
+    PrintCsvHeader(csv);
+
+    size_t initialized = 0;
+    size_t measured = 0;
+    size_t tick = 0;
+    real_T sink = 0.0;
+    boolean_T failed = false;
+
+    for (size_t c = 0; c < point_count && !failed; c++) {
+        size_t n = counts[c];
+
+        /* 셀 추가 초기화 (RSS 차이로 실제 셀당 메모리 측정) */
+        size_t rss_before = ResidentBytes();
+        size_t added = n - initialized;
+        for (size_t i = initialized; i < n; i++) {
+            if (!SoC_Cell_Initialize(&cells[i], &config)) {
+                fprintf(stderr, "셀 초기화 실패 (%zu)\n", i);
+                failed = true;
+                break;
+            }
+            offsets[i] = (uint32_T)(fmod((double)i * FLEET_SHIFT, 1.0) * (double)trace.steps) %
+                         (uint32_T)trace.steps;
+            initialized = i + 1;
+        }
+        if (failed) {
+            break;
+        }
+        size_t rss_after = ResidentBytes();
+        double rss_per_cell = (added > 0 && rss_after > rss_before) ?
+                              (double)(rss_after - rss_before) / (double)added : 0.0;
+
+        /* 틱 수: 목표 스텝 수 / 셀 수, batch 블록의 배수 */
+        size_t ticks = (size_t)ceil(budget / (double)n / FLEET_BLOCK) * FLEET_BLOCK;
+
+        for (int e = 0; e < ENGINES; e++) {
+            for (size_t s = 0; s < thread_steps && (size_t)thread_counts[s] <= n; s++) {
+                uint32_T threads = thread_counts[s];
+
+                /* 예열: 모든 셀 상태를 한 번 불러옴 (측정 제외) */
+                Fleet_Measure(cells, offsets, &trace, n, threads, tick, 1, ENGINE_INSTANCE, NULL, &sink);
+                tick = (tick + 1) % trace.steps;
+
+                Fleet_Point_T* point = &points[measured];
+                point->engine = (Fleet_Engine_T)e;
+                point->threads = threads;
+                point->cells = n;
+                point->ticks = ticks;
+                point->rss_per_cell = rss_per_cell;
+                Perf_Reset(&point->counters);
+                point->seconds = Fleet_Measure(cells, offsets, &trace, n, threads, tick, ticks,
+                                               (Fleet_Engine_T)e, &point->counters, &sink);
+                point->cell_steps_per_s = (point->seconds > 0.0) ?
+                                          (double)n * (double)ticks / point->seconds : 0.0;
+                tick = (tick + ticks) % trace.steps;
+
+                PrintCsvRow(csv, point, state_bytes);
+                fflush(csv);
+                fprintf(stderr, "  %-8s %3u 스레드 %9zu 셀: %.3e cell-steps/s\n", g_engine_names[e],
+                        (unsigned)threads, n, point->cell_steps_per_s);
+                measured++;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < initialized; i++) {
+        SoC_Cell_Cleanup(&cells[i]);
+    }
+
+    int status = failed ? 1 : 0;
+    if (csv != stdout) {
+        fclose(csv);
+        fprintf(stderr, "# CSV: %s\n", csv_path);
+        if (!WriteJson(json_path, path, &trace, points, measured, max_cells, run_cells, state_bytes, &heap,
+                       caches)) {
+            fprintf(stderr, "출력 파일을 쓸 수 없음: %s\n", json_path);
+            status = 1;
+        } else {
+            fprintf(stderr, "# JSON: %s\n", json_path);
+        }
+    }
+
+    fprintf(stderr, "# sink %.6g\n", (double)sink);
+    free(cells);
+    free(offsets);
+    free(points);
+    Perf_Close(&g_perf);
+    TRACE_Close(&trace);
+    return status;
+}
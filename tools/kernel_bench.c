@@ -0,0 +1,661 @@
+/*
+ * kernel_bench.c
+ *
+ * 수학 커널 마이크로 벤치마크 (make microbench)
+ * - SIMD_Vector* 전체와 같은 연산의 스칼라 C 구현 비교
+ * - Matrix2x2_* / Matrix3x3_* 연산, 패딩된 3x3 (Matrix3x3_*Padded) 연산
+ * - LookupTable_BinarySearch / LookupTable_LinearSearch / look1_binlxpw (테이블 크기별)
+ *
+ * 측정 방법:
+ * - 지정한 CPU에 고정 (Linux), 예열 시행 1회 후 반복 시행의 중앙값 보고
+ * - 시행당 반복 수는 예비 측정으로 약 BENCH_TRIAL_NS가 되도록 보정
+ * - cycles/op는 x86 TSC 기준 (터보 / 절전 시 코어 클럭과 다를 수 있음),
+ *   TSC가 없는 플랫폼에서는 0으로 표시
+ * - 데드 코드 제거 방지: 피연산자 집합을 순환하며 입력하고, 호출마다 메모리 장벽으로
+ *   출력 저장을 강제하며, 반환값은 누적하여 마지막에 출력
+ *
+ * 사용법:
+ *   kernel_bench [cpu [trials]]
+ *   SOC_PERF=1이면 시간 측정이 끝난 뒤 같은 반복 수로 한 번 더 실행하면서 하드웨어
+ *   카운터를 읽어 IPC와 연산당 L1D / LLC 미스, 분기 예측 실패를 열로 추가
+ *   (사용할 수 없는 카운터는 n/a, 카운터 실행은 시간 측정에 포함되지 않음)
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(__linux__)
+    #include <sched.h>
+    #define BENCH_HAVE_AFFINITY  1
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define BENCH_HAVE_TSC  1
+#endif
+
+#include "core/lookup_table.h"
+#include "core/perf_counters.h"
+#include "math/matrix_ops.h"
+#include "math/matrix_padded.h"
+#include "math/simd_ops.h"
+
+#include "../rtwtypes.h"
+
+/* 상수 정의 */
+#define BENCH_DEFAULT_TRIALS       9       /* 측정 시행 횟수 */
+#define BENCH_MAX_TRIALS           64
+#define BENCH_TRIAL_NS             5e6     /* 시행당 목표 시간 (ns) */
+#define BENCH_PROBE_ITERATIONS     256     /* 보정용 예비 반복 수 */
+#define BENCH_OPERAND_SETS         64      /* 순환 피연산자 집합 수 (2의 거듭제곱) */
+#define BENCH_OPERAND_SIZE         16      /* 집합당 double 개수 (3x3 행렬 + 여유) */
+#define BENCH_SUM_LENGTH           256     /* SIMD_VectorSum 입력 길이 */
+#define BENCH_QUERIES              1024    /* 테이블 검색 질의 수 (2의 거듭제곱) */
+
+#if defined(__GNUC__)
+    #define BENCH_NOINLINE  __attribute__((noinline))
+    #define BENCH_CLOBBER() __asm__ volatile("" : : : "memory")
+#else
+    #define BENCH_NOINLINE
+    #define BENCH_CLOBBER() ((void)0)
+#endif
+
+/* 스칼라 기준 구현은 자동 벡터화 없이 컴파일 (GCC) */
+#if defined(__GNUC__) && !defined(__clang__)
+    #define BENCH_SCALAR  BENCH_NOINLINE __attribute__((optimize("no-tree-vectorize")))
+#else
+    #define BENCH_SCALAR  BENCH_NOINLINE
+#endif
+
+/* 커널 형태 */
+typedef enum {
+    KERNEL_BINARY,                 /* void f(const real_T* A, const real_T* B, real_T* C) */
+    KERNEL_SCALE,                  /* void f(const real_T* A, real_T k, real_T* C) */
+    KERNEL_UNARY,                  /* void f(const real_T* A, real_T* B) */
+    KERNEL_REDUCE,                 /* real_T f(const real_T* A) */
+    KERNEL_DOT,                    /* real_T f(const real_T* A, const real_T* B) */
+    KERNEL_SUM,                    /* real_T f(const real_T* A, size_t n) */
+    KERNEL_INVERSE,                /* boolean_T f(const real_T* A, real_T* B) */
+    KERNEL_TERNARY,                /* void f(const real_T* A, const real_T* B, const real_T* C, real_T* D) */
+    KERNEL_SEARCH,                 /* uint32_T f(const LookupTable_T* table, real_T x) */
+    KERNEL_LOOK1                   /* look1_binlxpw */
+} Kernel_Kind_T;
+
+typedef struct {
+    const char* group;
+    const char* name;
+    Kernel_Kind_T kind;
+    void (*binary)(const real_T*, const real_T*, real_T*);
+    void (*scale)(const real_T*, real_T, real_T*);
+    void (*unary)(const real_T*, real_T*);
+    real_T (*reduce)(const real_T*);
+    real_T (*dot)(const real_T*, const real_T*);
+    real_T (*sum)(const real_T*, size_t);
+    boolean_T (*inverse)(const real_T*, real_T*);
+    void (*ternary)(const real_T*, const real_T*, const real_T*, real_T*);
+    uint32_T (*search)(const LookupTable_T*, real_T);
+    uint32_T table_points;         /* 검색 커널의 테이블 크기 */
+} Kernel_T;
+
+/* 측정 결과 */
+typedef struct {
+    double cycles;                 /* 중앙값 cycles/op */
+    double ns;                     /* 중앙값 ns/op */
+    double spread;                 /* (최대 - 최소) / 중앙값, ns 기준 */
+    Perf_Sample_T counters;        /* 카운터 실행 결과 (SOC_PERF=1) */
+    size_t iterations;             /* 시행당 반복 수 */
+} Kernel_Result_T;
+
+/* 피연산자 / 출력 / 누적 */
+static real_T g_a[BENCH_OPERAND_SETS * BENCH_OPERAND_SIZE];
+static real_T g_b[BENCH_OPERAND_SETS * BENCH_OPERAND_SIZE];
+static real_T g_c[BENCH_OPERAND_SETS * BENCH_OPERAND_SIZE];
+static real_T g_out[BENCH_OPERAND_SIZE];
+static real_T g_sum_input[BENCH_OPERAND_SETS + BENCH_SUM_LENGTH];
+static real_T g_queries[BENCH_QUERIES];
+static volatile real_T g_sink;
+
+/* 검색 커널용 테이블 */
+static LookupTable_T g_table;
+static real_T* g_breakpoints;
+static real_T* g_table_data;
+
+/* 하드웨어 카운터 (SOC_PERF=1일 때만 열림) */
+static Perf_Counters_T g_perf;
+
+/* ========================================================================
+ * 스칼라 기준 구현 (SIMD_Vector*와 같은 의미)
+ * ======================================================================== */
+
+BENCH_SCALAR static void Scalar_Add2(const real_T* A, const real_T* B, real_T* C)
+{
+    C[0] = A[0] + B[0];
+    C[1] = A[1] + B[1];
+}
+
+BENCH_SCALAR static void Scalar_Subtract2(const real_T* A, const real_T* B, real_T* C)
+{
+    C[0] = A[0] - B[0];
+    C[1] = A[1] - B[1];
+}
+
+BENCH_SCALAR static void Scalar_Multiply2(const real_T* A, const real_T* B, real_T* C)
+{
+    C[0] = A[0] * B[0];
+    C[1] = A[1] * B[1];
+}
+
+BENCH_SCALAR static void Scalar_Divide2(const real_T* A, const real_T* B, real_T* C)
+{
+    C[0] = A[0] / B[0];
+    C[1] = A[1] / B[1];
+}
+
+BENCH_SCALAR static void Scalar_ScalarMultiply2(const real_T* A, real_T k, real_T* C)
+{
+    C[0] = A[0] * k;
+    C[1] = A[1] * k;
+}
+
+BENCH_SCALAR static void Scalar_Add4(const real_T* A, const real_T* B, real_T* C)
+{
+    for (int i = 0; i < 4; i++) {
+        C[i] = A[i] + B[i];
+    }
+}
+
+BENCH_SCALAR static void Scalar_Subtract4(const real_T* A, const real_T* B, real_T* C)
+{
+    for (int i = 0; i < 4; i++) {
+        C[i] = A[i] - B[i];
+    }
+}
+
+BENCH_SCALAR static void Scalar_Multiply4(const real_T* A, const real_T* B, real_T* C)
+{
+    for (int i = 0; i < 4; i++) {
+        C[i] = A[i] * B[i];
+    }
+}
+
+BENCH_SCALAR static void Scalar_ScalarMultiply4(const real_T* A, real_T k, real_T* C)
+{
+    for (int i = 0; i < 4; i++) {
+        C[i] = A[i] * k;
+    }
+}
+
+BENCH_SCALAR static void Scalar_Add8(const real_T* A, const real_T* B, real_T* C)
+{
+    for (int i = 0; i < 8; i++) {
+        C[i] = A[i] + B[i];
+    }
+}
+
+BENCH_SCALAR static void Scalar_Subtract8(const real_T* A, const real_T* B, real_T* C)
+{
+    for (int i = 0; i < 8; i++) {
+        C[i] = A[i] - B[i];
+    }
+}
+
+BENCH_SCALAR static void Scalar_ScalarMultiply8(const real_T* A, real_T k, real_T* C)
+{
+    for (int i = 0; i < 8; i++) {
+        C[i] = A[i] * k;
+    }
+}
+
+BENCH_SCALAR static real_T Scalar_DotProduct2(const real_T* A, const real_T* B)
+{
+    return A[0] * B[0] + A[1] * B[1];
+}
+
+BENCH_SCALAR static real_T Scalar_DotProduct4(const real_T* A, const real_T* B)
+{
+    real_T sum = 0.0;
+    for (int i = 0; i < 4; i++) {
+        sum += A[i] * B[i];
+    }
+    return sum;
+}
+
+BENCH_SCALAR static real_T Scalar_DotProduct8(const real_T* A, const real_T* B)
+{
+    real_T sum = 0.0;
+    for (int i = 0; i < 8; i++) {
+        sum += A[i] * B[i];
+    }
+    return sum;
+}
+
+BENCH_SCALAR static real_T Scalar_Sum(const real_T* A, size_t n)
+{
+    real_T sum = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        sum += A[i];
+    }
+    return sum;
+}
+
+BENCH_SCALAR static real_T Scalar_Max2(const real_T* A)
+{
+    return (A[0] > A[1]) ? A[0] : A[1];
+}
+
+BENCH_SCALAR static real_T Scalar_Min2(const real_T* A)
+{
+    return (A[0] < A[1]) ? A[0] : A[1];
+}
+
+BENCH_SCALAR static void Scalar_Abs2(const real_T* A, real_T* B)
+{
+    B[0] = fabs(A[0]);
+    B[1] = fabs(A[1]);
+}
+
+BENCH_SCALAR static void Scalar_Sqrt2(const real_T* A, real_T* B)
+{
+    B[0] = sqrt(A[0]);
+    B[1] = sqrt(A[1]);
+}
+
+/* ========================================================================
+ * 패딩 행렬 커널 (피연산자 집합 16요소를 3x4 행렬 하나로 사용)
+ * ======================================================================== */
+
+static void Padded_Multiply(const real_T* A, const real_T* B, real_T* C)
+{
+    Matrix3x3_MultiplyPadded((const Matrix3x3_Padded_T*)A, (const Matrix3x3_Padded_T*)B,
+                             (Matrix3x3_Padded_T*)C);
+}
+
+static void Padded_Add(const real_T* A, const real_T* B, real_T* C)
+{
+    Matrix3x3_AddPadded((const Matrix3x3_Padded_T*)A, (const Matrix3x3_Padded_T*)B,
+                        (Matrix3x3_Padded_T*)C);
+}
+
+static void Padded_Rank1Update(const real_T* A, const real_T* u, const real_T* v, real_T* C)
+{
+    Matrix3x3_Rank1UpdatePadded((const Matrix3x3_Padded_T*)A, 0.5, u, v, (Matrix3x3_Padded_T*)C);
+}
+
+/* ========================================================================
+ * 커널 목록
+ * ======================================================================== */
+
+#define K_BINARY(g, n, f)   { g, n, KERNEL_BINARY,  f, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0 }
+#define K_SCALE(g, n, f)    { g, n, KERNEL_SCALE,   NULL, f, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0 }
+#define K_UNARY(g, n, f)    { g, n, KERNEL_UNARY,   NULL, NULL, f, NULL, NULL, NULL, NULL, NULL, NULL, 0 }
+#define K_REDUCE(g, n, f)   { g, n, KERNEL_REDUCE,  NULL, NULL, NULL, f, NULL, NULL, NULL, NULL, NULL, 0 }
+#define K_DOT(g, n, f)      { g, n, KERNEL_DOT,     NULL, NULL, NULL, NULL, f, NULL, NULL, NULL, NULL, 0 }
+#define K_SUM(g, n, f)      { g, n, KERNEL_SUM,     NULL, NULL, NULL, NULL, NULL, f, NULL, NULL, NULL, 0 }
+#define K_INVERSE(g, n, f)  { g, n, KERNEL_INVERSE, NULL, NULL, NULL, NULL, NULL, NULL, f, NULL, NULL, 0 }
+#define K_TERNARY(g, n, f)  { g, n, KERNEL_TERNARY, NULL, NULL, NULL, NULL, NULL, NULL, NULL, f, NULL, 0 }
+#define K_SEARCH(n, f, p)   { "lookup", n, KERNEL_SEARCH, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, f, p }
+#define K_LOOK1(p)          { "lookup", "look1_binlxpw", KERNEL_LOOK1, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, p }
+
+static const Kernel_T g_kernels[] = {
+    /* SIMD와 스칼라 기준 (쌍으로 나열) */
+    K_BINARY("simd", "SIMD_VectorAdd2", SIMD_VectorAdd2),
+    K_BINARY("scalar", "Add2", Scalar_Add2),
+    K_BINARY("simd", "SIMD_VectorSubtract2", SIMD_VectorSubtract2),
+    K_BINARY("scalar", "Subtract2", Scalar_Subtract2),
+    K_BINARY("simd", "SIMD_VectorMultiply2", SIMD_VectorMultiply2),
+    K_BINARY("scalar", "Multiply2", Scalar_Multiply2),
+    K_BINARY("simd", "SIMD_VectorDivide2", SIMD_VectorDivide2),
+    K_BINARY("scalar", "Divide2", Scalar_Divide2),
+    K_SCALE("simd", "SIMD_VectorScalarMultiply2", SIMD_VectorScalarMultiply2),
+    K_SCALE("scalar", "ScalarMultiply2", Scalar_ScalarMultiply2),
+    K_BINARY("simd", "SIMD_VectorAdd4", SIMD_VectorAdd4),
+    K_BINARY("scalar", "Add4", Scalar_Add4),
+    K_BINARY("simd", "SIMD_VectorSubtract4", SIMD_VectorSubtract4),
+    K_BINARY("scalar", "Subtract4", Scalar_Subtract4),
+    K_BINARY("simd", "SIMD_VectorMultiply4", SIMD_VectorMultiply4),
+    K_BINARY("scalar", "Multiply4", Scalar_Multiply4),
+    K_SCALE("simd", "SIMD_VectorScalarMultiply4", SIMD_VectorScalarMultiply4),
+    K_SCALE("scalar", "ScalarMultiply4", Scalar_ScalarMultiply4),
+    K_BINARY("simd", "SIMD_VectorAdd8", SIMD_VectorAdd8),
+    K_BINARY("scalar", "Add8", Scalar_Add8),
+    K_BINARY("simd", "SIMD_VectorSubtract8", SIMD_VectorSubtract8),
+    K_BINARY("scalar", "Subtract8", Scalar_Subtract8),
+    K_SCALE("simd", "SIMD_VectorScalarMultiply8", SIMD_VectorScalarMultiply8),
+    K_SCALE("scalar", "ScalarMultiply8", Scalar_ScalarMultiply8),
+    K_DOT("simd", "SIMD_VectorDotProduct2", SIMD_VectorDotProduct2),
+    K_DOT("scalar", "DotProduct2", Scalar_DotProduct2),
+    K_DOT("simd", "SIMD_VectorDotProduct4", SIMD_VectorDotProduct4),
+    K_DOT("scalar", "DotProduct4", Scalar_DotProduct4),
+    K_DOT("simd", "SIMD_VectorDotProduct8", SIMD_VectorDotProduct8),
+    K_DOT("scalar", "DotProduct8", Scalar_DotProduct8),
+    K_SUM("simd", "SIMD_VectorSum(256)", SIMD_VectorSum),
+    K_SUM("scalar", "Sum(256)", Scalar_Sum),
+    K_REDUCE("simd", "SIMD_VectorMax2", SIMD_VectorMax2),
+    K_REDUCE("scalar", "Max2", Scalar_Max2),
+    K_REDUCE("simd", "SIMD_VectorMin2", SIMD_VectorMin2),
+    K_REDUCE("scalar", "Min2", Scalar_Min2),
+    K_UNARY("simd", "SIMD_VectorAbs2", SIMD_VectorAbs2),
+    K_UNARY("scalar", "Abs2", Scalar_Abs2),
+    K_UNARY("simd", "SIMD_VectorSqrt2", SIMD_VectorSqrt2),
+    K_UNARY("scalar", "Sqrt2", Scalar_Sqrt2),
+
+    /* 행렬 연산 */
+    K_BINARY("matrix", "Matrix2x2_Multiply", Matrix2x2_Multiply),
+    K_UNARY("matrix", "Matrix2x2_Transpose", Matrix2x2_Transpose),
+    K_BINARY("matrix", "Matrix2x2_Add", Matrix2x2_Add),
+    K_BINARY("matrix", "Matrix2x2_Subtract", Matrix2x2_Subtract),
+    K_INVERSE("matrix", "Matrix2x2_Inverse", Matrix2x2_Inverse),
+    K_REDUCE("matrix", "Matrix2x2_Determinant", Matrix2x2_Determinant),
+    K_SCALE("matrix", "Matrix2x2_ScalarMultiply", Matrix2x2_ScalarMultiply),
+    K_TERNARY("matrix", "Matrix2x2_CovariancePredict", Matrix2x2_CovariancePredict),
+    K_TERNARY("matrix", "Matrix2x2_CovarianceUpdate", Matrix2x2_CovarianceUpdate),
+    K_BINARY("matrix", "Matrix3x3_Multiply", Matrix3x3_Multiply),
+    K_UNARY("matrix", "Matrix3x3_Transpose", Matrix3x3_Transpose),
+    K_BINARY("matrix", "Matrix3x3_Add", Matrix3x3_Add),
+    K_BINARY("matrix", "Matrix3x3_Subtract", Matrix3x3_Subtract),
+    K_INVERSE("matrix", "Matrix3x3_Inverse", Matrix3x3_Inverse),
+    K_REDUCE("matrix", "Matrix3x3_Determinant", Matrix3x3_Determinant),
+    K_SCALE("matrix", "Matrix3x3_ScalarMultiply", Matrix3x3_ScalarMultiply),
+    K_TERNARY("matrix", "Matrix3x3_CovariancePredict", Matrix3x3_CovariancePredict),
+    K_TERNARY("matrix", "Matrix3x3_CovarianceUpdate", Matrix3x3_CovarianceUpdate),
+    K_BINARY("padded", "Matrix3x3_MultiplyPadded", Padded_Multiply),
+    K_BINARY("padded", "Matrix3x3_AddPadded", Padded_Add),
+    K_TERNARY("padded", "Matrix3x3_Rank1UpdatePadded", Padded_Rank1Update)
+};
+
+/* 테이블 검색 커널 크기 (201은 SoCesti OCV 테이블과 같은 크기) */
+static const uint32_T g_table_sizes[] = { 8, 32, 201, 1024, 8192 };
+
+/* ========================================================================
+ * 측정
+ * ======================================================================== */
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_T Cycles(void)
+{
+#ifdef BENCH_HAVE_TSC
+    return (uint64_T)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief 커널을 iterations번 실행 (피연산자 집합 순환, 호출마다 메모리 장벽)
+ */
+static void RunKernel(const Kernel_T* kernel, size_t iterations)
+{
+    real_T acc = 0.0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        size_t set = (i & (BENCH_OPERAND_SETS - 1)) * BENCH_OPERAND_SIZE;
+        const real_T* a = &g_a[set];
+        const real_T* b = &g_b[set];
+        const real_T* c = &g_c[set];
+
+        switch (kernel->kind) {
+            case KERNEL_BINARY:
+                kernel->binary(a, b, g_out);
+                break;
+            case KERNEL_SCALE:
+                kernel->scale(a, b[0], g_out);
+                break;
+            case KERNEL_UNARY:
+                kernel->unary(a, g_out);
+                break;
+            case KERNEL_REDUCE:
+                acc += kernel->reduce(a);
+                break;
+            case KERNEL_DOT:
+                acc += kernel->dot(a, b);
+                break;
+            case KERNEL_SUM:
+                acc += kernel->sum(&g_sum_input[i & (BENCH_OPERAND_SETS - 1)], BENCH_SUM_LENGTH);
+                break;
+            case KERNEL_INVERSE:
+                acc += (real_T)kernel->inverse(a, g_out);
+                break;
+            case KERNEL_TERNARY:
+                kernel->ternary(a, b, c, g_out);
+                break;
+            case KERNEL_SEARCH:
+                acc += (real_T)kernel->search(&g_table, g_queries[i & (BENCH_QUERIES - 1)]);
+                break;
+            case KERNEL_LOOK1:
+                acc += look1_binlxpw(g_queries[i & (BENCH_QUERIES - 1)], g_breakpoints,
+                                     g_table_data, kernel->table_points - 1);
+                break;
+        }
+        BENCH_CLOBBER();
+    }
+
+    g_sink += acc;
+}
+
+static int CompareDouble(const void* a, const void* b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief 예열 + 반복 보정 + 시행별 측정 후 중앙값 계산
+ */
+static void Measure(const Kernel_T* kernel, uint32_T trials, Kernel_Result_T* result)
+{
+    double ns[BENCH_MAX_TRIALS];
+    double cycles[BENCH_MAX_TRIALS];
+
+    /* 예열 및 반복 수 보정 */
+    double t0 = Now();
+    RunKernel(kernel, BENCH_PROBE_ITERATIONS);
+    double probe = (Now() - t0) / BENCH_PROBE_ITERATIONS;
+    size_t iterations = (probe > 0.0) ? (size_t)(BENCH_TRIAL_NS / probe) : BENCH_PROBE_ITERATIONS;
+    if (iterations < BENCH_PROBE_ITERATIONS) {
+        iterations = BENCH_PROBE_ITERATIONS;
+    }
+    RunKernel(kernel, iterations);
+
+    for (uint32_T t = 0; t < trials; t++) {
+        double start = Now();
+        uint64_T c0 = Cycles();
+        RunKernel(kernel, iterations);
+        uint64_T c1 = Cycles();
+        double end = Now();
+
+        ns[t] = (end - start) / (double)iterations;
+        cycles[t] = (double)(c1 - c0) / (double)iterations;
+    }
+
+    qsort(ns, trials, sizeof(double), CompareDouble);
+    qsort(cycles, trials, sizeof(double), CompareDouble);
+    result->ns = ns[trials / 2];
+    result->cycles = cycles[trials / 2];
+    result->spread = (result->ns > 0.0) ? (ns[trials - 1] - ns[0]) / result->ns : 0.0;
+    result->iterations = iterations;
+
+    Perf_Reset(&result->counters);
+    if (g_perf.opened > 0) {
+        Perf_Start(&g_perf);
+        RunKernel(kernel, iterations);
+        Perf_Stop(&g_perf, &result->counters);
+    }
+}
+
+/* 카운터 열 (없는 값은 n/a) */
+static void PrintCounter(real_T value, const char* format)
+{
+    if (value < 0.0) {
+        printf(" %9s", "n/a");
+    } else {
+        printf(format, value);
+    }
+}
+
+static void PrintResult(const char* group, const char* name, const Kernel_Result_T* result)
+{
+    printf("%-8s %-34s %10.2f %10.2f %12.2f %8.1f", group, name, result->cycles, result->ns,
+           (result->ns > 0.0) ? 1e3 / result->ns : 0.0, result->spread * 100.0);
+    if (g_perf.opened > 0) {
+        real_T ops = (real_T)result->iterations;
+        PrintCounter(Perf_GetIPC(&result->counters), " %9.2f");
+        PrintCounter(Perf_GetPerUnit(&result->counters, PERF_L1D_MISSES, ops), " %9.4f");
+        PrintCounter(Perf_GetPerUnit(&result->counters, PERF_LLC_MISSES, ops), " %9.5f");
+        PrintCounter(Perf_GetPerUnit(&result->counters, PERF_BRANCH_MISSES, ops), " %9.4f");
+    }
+    printf("\n");
+}
+
+/* ========================================================================
+ * 입력 준비
+ * ======================================================================== */
+
+static uint32_T g_seed = 12345u;
+
+static real_T Random(void)
+{
+    g_seed = g_seed * 1664525u + 1013904223u;
+    return (real_T)(g_seed >> 8) / 16777216.0;
+}
+
+static void PrepareOperands(void)
+{
+    /* 양수, 대각 우세 (나눗셈 / 제곱근 / 역행렬이 정상 경로를 타도록) */
+    for (size_t s = 0; s < BENCH_OPERAND_SETS; s++) {
+        for (size_t i = 0; i < BENCH_OPERAND_SIZE; i++) {
+            g_a[s * BENCH_OPERAND_SIZE + i] = 0.5 + Random();
+            g_b[s * BENCH_OPERAND_SIZE + i] = 0.5 + Random();
+            g_c[s * BENCH_OPERAND_SIZE + i] = 0.5 + Random();
+        }
+        g_a[s * BENCH_OPERAND_SIZE + 0] += 4.0;
+        g_a[s * BENCH_OPERAND_SIZE + 3] += 4.0;  /* 2x2 대각 */
+        g_a[s * BENCH_OPERAND_SIZE + 4] += 4.0;
+        g_a[s * BENCH_OPERAND_SIZE + 8] += 4.0;  /* 3x3 대각 */
+    }
+    for (size_t i = 0; i < BENCH_OPERAND_SETS + BENCH_SUM_LENGTH; i++) {
+        g_sum_input[i] = Random();
+    }
+    for (size_t i = 0; i < BENCH_QUERIES; i++) {
+        g_queries[i] = Random();
+    }
+}
+
+static boolean_T PrepareTable(uint32_T points)
+{
+    LookupTable_Params_T params;
+    params.max_points = points;
+    params.use_binary_search = true;
+    params.enable_extrapolation = false;
+
+    free(g_breakpoints);
+    free(g_table_data);
+    g_breakpoints = (real_T*)malloc(points * sizeof(real_T));
+    g_table_data = (real_T*)malloc(points * sizeof(real_T));
+    if (g_breakpoints == NULL || g_table_data == NULL) {
+        return false;
+    }
+
+    for (uint32_T i = 0; i < points; i++) {
+        g_breakpoints[i] = (real_T)i / (real_T)(points - 1);
+        g_table_data[i] = 3.0 + 1.2 * g_breakpoints[i] * g_breakpoints[i];
+    }
+
+    LookupTable_Cleanup(&g_table);
+    return LookupTable_Initialize(&g_table, &params, g_breakpoints, g_table_data, points);
+}
+
+/* CPU 고정 (Linux) */
+static boolean_T PinCpu(int cpu)
+{
+#ifdef BENCH_HAVE_AFFINITY
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return (boolean_T)(sched_setaffinity(0, sizeof(set), &set) == 0);
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    int cpu = (argc >= 2) ? atoi(argv[1]) : 0;
+    uint32_T trials = (argc >= 3) ? (uint32_T)atoi(argv[2]) : BENCH_DEFAULT_TRIALS;
+
+    if (argc > 3 || cpu < 0 || trials == 0 || trials > BENCH_MAX_TRIALS) {
+        fprintf(stderr, "사용법: %s [cpu [trials (1..%d)]]\n", argv[0], BENCH_MAX_TRIALS);
+        return 1;
+    }
+
+    boolean_T pinned = PinCpu(cpu);
+    if (Perf_Requested()) {
+        Perf_Open(&g_perf);
+    }
+    printf("# CPU %d %s, 시행 %u회 (중앙값), cycles = %s\n", cpu, pinned ? "고정" : "고정 실패",
+           (unsigned)trials,
+#ifdef BENCH_HAVE_TSC
+           "TSC"
+#else
+           "없음"
+#endif
+           );
+    if (Perf_Requested()) {
+        printf("# 하드웨어 카운터: %s\n", Perf_Describe(&g_perf));
+    }
+    printf("%-8s %-34s %10s %10s %12s %8s", "group", "kernel", "cycles/op", "ns/op", "Mops/s", "spread%");
+    if (g_perf.opened > 0) {
+        printf(" %9s %9s %9s %9s", "IPC", "L1D/op", "LLC/op", "brmiss/op");
+    }
+    printf("\n");
+
+    PrepareOperands();
+    memset(&g_table, 0, sizeof(LookupTable_T));
+
+    Kernel_Result_T result;
+    for (size_t i = 0; i < sizeof(g_kernels) / sizeof(g_kernels[0]); i++) {
+        Measure(&g_kernels[i], trials, &result);
+        PrintResult(g_kernels[i].group, g_kernels[i].name, &result);
+    }
+
+    /* 테이블 크기별 검색 */
+    for (size_t s = 0; s < sizeof(g_table_sizes) / sizeof(g_table_sizes[0]); s++) {
+        uint32_T points = g_table_sizes[s];
+        if (!PrepareTable(points)) {
+            fprintf(stderr, "테이블 준비 실패 (%u)\n", (unsigned)points);
+            continue;
+        }
+
+        const Kernel_T kernels[] = {
+            K_SEARCH("LookupTable_BinarySearch", LookupTable_BinarySearch, points),
+            K_SEARCH("LookupTable_LinearSearch", LookupTable_LinearSearch, points),
+            K_LOOK1(points)
+        };
+        for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s(%u)", kernels[k].name, (unsigned)points);
+            Measure(&kernels[k], trials, &result);
+            PrintResult(kernels[k].group, name, &result);
+        }
+    }
+
+    LookupTable_Cleanup(&g_table);
+    free(g_breakpoints);
+    free(g_table_data);
+    Perf_Close(&g_perf);
+
+    printf("# sink %.6g\n", (double)g_sink);
+    return 0;
+}
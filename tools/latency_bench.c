@@ -0,0 +1,444 @@
+/*
+ * latency_bench.c
+ *
+ * 스텝 지연 분포 / 최악 실행 시간 측정 (make latency)
+ * WSN9 기록을 반복 재생하면서 SoC_System_Step과 기존 SoCesti_step의 스텝 하나하나의
+ * 실행 시간을 로그 버킷 히스토그램(HDR 방식)에 기록하고 p50 ~ p99.999 / 최대값과
+ * 가장 느린 스텝의 샘플 인덱스를 출력
+ *
+ * 측정 방법:
+ * - 지정 CPU에 고정 (Linux). 격리 코어(isolcpus / nohz_full)는 커널 설정이므로
+ *   /sys/devices/system/cpu/isolated 내용을 함께 출력
+ * - x86은 lfence + rdtsc / rdtscp로 스텝을 감싸고, clock_gettime으로 보정한 TSC
+ *   주파수로 ns 변환. 그 외 플랫폼은 clock_gettime
+ * - 빈 구간 측정의 최소값(타이머 오버헤드)을 각 표본에서 차감
+ * - 히스토그램: 128 ns 미만은 1 ns 단위, 그 이상은 2의 거듭제곱 구간마다 64개 버킷
+ *   (상대 오차 1/64 이하)
+ *
+ * 기존 생성 코드는 replay_bench와 같이 LEGACY_RENAMES로 접두사를 붙여 링크
+ *
+ * 사용법:
+ *   latency_bench [trace.mat|trace.socbin [cpu [repeats [output_prefix]]]]
+ *   (output_prefix를 주면 <prefix>.modular.hgrm / <prefix>.legacy.hgrm에
+ *    HdrHistogram 백분위 분포 형식으로 기록)
+ *   SOC_PERF=1이면 반복마다 스텝 루프 전체에 하드웨어 카운터를 걸어 스텝당 평균을 출력
+ *   (스텝별 값이 아니며 타이머 / 히스토그램 기록 비용이 포함됨, 순수 값은 replay_bench)
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__linux__)
+    #include <sched.h>
+    #define LATENCY_HAVE_AFFINITY  1
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define LATENCY_HAVE_TSC  1
+#endif
+
+#include "core/perf_counters.h"
+#include "io/trace_reader.h"
+
+#include "../rtwtypes.h"
+#include "../SoCesti.h"
+
+/* 상수 정의 */
+#define DEFAULT_TRACE              "WSN9.mat"
+#define DEFAULT_REPEATS            10
+#define HIST_LINEAR                128     /* 1 ns 단위 버킷 수 */
+#define HIST_SUB_BITS              6       /* 2의 거듭제곱 구간당 버킷 수 = 2^6 */
+#define HIST_SUB_COUNT             (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS               (HIST_LINEAR + (64 - 7) * HIST_SUB_COUNT)
+#define OUTLIER_COUNT              10      /* 보고할 가장 느린 스텝 수 */
+#define CALIBRATION_NS             100e6   /* TSC 보정 시간 */
+#define OVERHEAD_SAMPLES           10000   /* 타이머 오버헤드 측정 횟수 */
+
+/* main.c의 모듈화된 시스템 (BENCH 빌드에서는 main() 없이 링크) */
+extern boolean_T SoC_System_Initialize(void);
+extern void SoC_System_Cleanup(void);
+extern real_T SoC_System_Step(real_T current, real_T voltage);
+
+/* 느린 스텝 기록 */
+typedef struct {
+    uint64_t ns;
+    size_t step;                   /* 기록 내 샘플 인덱스 */
+    uint32_T repeat;               /* 반복 번호 */
+} Latency_Outlier_T;
+
+/* 로그 버킷 히스토그램 */
+typedef struct {
+    uint64_t counts[HIST_BUCKETS];
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+    Latency_Outlier_T outliers[OUTLIER_COUNT]; /* 내림차순 */
+} Latency_Histogram_T;
+
+/* 하드웨어 카운터 (SOC_PERF=1일 때만 열림) */
+static Perf_Counters_T g_perf;
+
+/* 타이머 */
+static double g_ns_per_tick = 1.0;
+static uint64_t g_overhead = 0;
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t TimerStart(void)
+{
+#ifdef LATENCY_HAVE_TSC
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    return NowNs();
+#endif
+}
+
+static inline uint64_t TimerStop(void)
+{
+#ifdef LATENCY_HAVE_TSC
+    unsigned int aux;
+    uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+#else
+    return NowNs();
+#endif
+}
+
+/**
+ * @brief TSC 주파수 보정과 타이머 오버헤드 측정
+ */
+static void CalibrateTimer(void)
+{
+#ifdef LATENCY_HAVE_TSC
+    uint64_t ns0 = NowNs();
+    uint64_t t0 = TimerStart();
+    while ((double)(NowNs() - ns0) < CALIBRATION_NS) {
+    }
+    uint64_t ns1 = NowNs();
+    uint64_t t1 = TimerStop();
+    g_ns_per_tick = (double)(ns1 - ns0) / (double)(t1 - t0);
+#endif
+
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < OVERHEAD_SAMPLES; i++) {
+        uint64_t start = TimerStart();
+        uint64_t stop = TimerStop();
+        if (stop - start < overhead) {
+            overhead = stop - start;
+        }
+    }
+    g_overhead = overhead;
+}
+
+/* ========================================================================
+ * 히스토그램
+ * ======================================================================== */
+
+static uint32_T Histogram_Index(uint64_t value)
+{
+    if (value < HIST_LINEAR) {
+        return (uint32_T)value;
+    }
+    int exponent = 63 - __builtin_clzll(value);  /* 7 이상 */
+    uint64_t sub = (value >> (exponent - HIST_SUB_BITS)) & (HIST_SUB_COUNT - 1);
+    return (uint32_T)(HIST_LINEAR + (exponent - 7) * HIST_SUB_COUNT + sub);
+}
+
+/* 버킷에 속하는 가장 큰 값 (HdrHistogram의 highest equivalent value) */
+static uint64_t Histogram_BucketHigh(uint32_T index)
+{
+    if (index < HIST_LINEAR) {
+        return index;
+    }
+    uint32_T exponent = 7 + (index - HIST_LINEAR) / HIST_SUB_COUNT;
+    uint64_t sub = (index - HIST_LINEAR) % HIST_SUB_COUNT;
+    uint32_T shift = exponent - HIST_SUB_BITS;
+    return ((HIST_SUB_COUNT + sub) << shift) + (((uint64_t)1 << shift) - 1);
+}
+
+static void Histogram_Record(Latency_Histogram_T* hist, uint64_t ns, size_t step, uint32_T repeat)
+{
+    hist->counts[Histogram_Index(ns)]++;
+    hist->total++;
+    if (ns < hist->min) {
+        hist->min = ns;
+    }
+    if (ns > hist->max) {
+        hist->max = ns;
+    }
+
+    /* 상위 OUTLIER_COUNT개 유지 (삽입 정렬, 대부분 첫 비교에서 끝남) */
+    if (ns > hist->outliers[OUTLIER_COUNT - 1].ns) {
+        int i = OUTLIER_COUNT - 1;
+        while (i > 0 && hist->outliers[i - 1].ns < ns) {
+            hist->outliers[i] = hist->outliers[i - 1];
+            i--;
+        }
+        hist->outliers[i].ns = ns;
+        hist->outliers[i].step = step;
+        hist->outliers[i].repeat = repeat;
+    }
+}
+
+static uint64_t Histogram_Percentile(const Latency_Histogram_T* hist, double percentile)
+{
+    uint64_t target = (uint64_t)((percentile / 100.0) * (double)hist->total + 0.5);
+    if (target == 0) {
+        target = 1;
+    }
+
+    uint64_t seen = 0;
+    for (uint32_T i = 0; i < HIST_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen >= target) {
+            uint64_t high = Histogram_BucketHigh(i);
+            return (high < hist->max) ? high : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+/**
+ * @brief HdrHistogram 백분위 분포 형식 (.hgrm) 출력 (HistogramLogAnalyzer / 플로터용)
+ */
+static boolean_T Histogram_WriteHgrm(const Latency_Histogram_T* hist, const char* path)
+{
+    FILE* fp = fopen(path, "w");
+    if (fp == NULL) {
+        return false;
+    }
+
+    fprintf(fp, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount", "1/(1-Percentile)");
+    uint64_t seen = 0;
+    for (uint32_T i = 0; i < HIST_BUCKETS; i++) {
+        if (hist->counts[i] == 0) {
+            continue;
+        }
+        seen += hist->counts[i];
+        double fraction = (double)seen / (double)hist->total;
+        uint64_t value = Histogram_BucketHigh(i);
+        if (value > hist->max) {
+            value = hist->max;
+        }
+        if (seen < hist->total) {
+            fprintf(fp, "%12.3f %2.12f %10llu %14.2f\n", (double)value / 1000.0, fraction,
+                    (unsigned long long)seen, 1.0 / (1.0 - fraction));
+        } else {
+            fprintf(fp, "%12.3f %2.12f %10llu\n", (double)value / 1000.0, fraction,
+                    (unsigned long long)seen);
+        }
+    }
+    fprintf(fp, "#[Max = %12.3f, Total count = %12llu]\n", (double)hist->max / 1000.0,
+            (unsigned long long)hist->total);
+    fprintf(fp, "#[Unit = us]\n");
+
+    return (boolean_T)(fclose(fp) == 0);
+}
+
+/* ========================================================================
+ * 재생
+ * ======================================================================== */
+
+static inline void RecordStep(Latency_Histogram_T* hist, uint64_t start, uint64_t stop,
+                              size_t step, uint32_T repeat)
+{
+    uint64_t ticks = stop - start;
+    ticks = (ticks > g_overhead) ? ticks - g_overhead : 0;
+    Histogram_Record(hist, (uint64_t)((double)ticks * g_ns_per_tick + 0.5), step, repeat);
+}
+
+/* 모듈화된 시스템: 반복마다 초기화부터 재생 (초기화 / 해제는 측정 제외) */
+static void MeasureModular(const TRACE_Reader_T* trace, uint32_T repeats, Latency_Histogram_T* hist,
+                           Perf_Sample_T* counters)
+{
+    for (uint32_T r = 0; r < repeats; r++) {
+        SoC_System_Initialize();
+        Perf_Start(&g_perf);
+        for (size_t k = 0; k < trace->steps; k++) {
+            real_T current = trace->current[k];
+            real_T voltage = trace->voltage[k];
+            uint64_t start = TimerStart();
+            SoC_System_Step(current, voltage);
+            uint64_t stop = TimerStop();
+            RecordStep(hist, start, stop, k, r);
+        }
+        Perf_Stop(&g_perf, counters);
+        SoC_System_Cleanup();
+    }
+}
+
+/* 기존 생성 코드 */
+static void MeasureLegacy(const TRACE_Reader_T* trace, uint32_T repeats, Latency_Histogram_T* hist,
+                          Perf_Sample_T* counters)
+{
+    for (uint32_T r = 0; r < repeats; r++) {
+        SoCesti_initialize();
+        Perf_Start(&g_perf);
+        for (size_t k = 0; k < trace->steps; k++) {
+            SoCesti_U.current = trace->current[k];
+            SoCesti_U.voltage = trace->voltage[k];
+            uint64_t start = TimerStart();
+            SoCesti_step();
+            uint64_t stop = TimerStop();
+            RecordStep(hist, start, stop, k, r);
+        }
+        Perf_Stop(&g_perf, counters);
+        SoCesti_terminate();
+    }
+}
+
+static void PrintHistogram(const char* name, const Latency_Histogram_T* hist, const TRACE_Reader_T* trace,
+                           const Perf_Sample_T* counters)
+{
+    static const double percentiles[] = { 50.0, 90.0, 99.0, 99.9, 99.99, 99.999 };
+
+    printf("%s: %llu 스텝, 최소 %llu ns\n", name, (unsigned long long)hist->total,
+           (unsigned long long)hist->min);
+    for (size_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++) {
+        printf("  p%-8g %10llu ns\n", percentiles[i],
+               (unsigned long long)Histogram_Percentile(hist, percentiles[i]));
+    }
+    printf("  max       %10llu ns\n", (unsigned long long)hist->max);
+    if (g_perf.opened > 0) {
+        printf("  카운터: ");
+        Perf_PrintSummary(stdout, counters, (real_T)hist->total, "스텝");
+    }
+
+    printf("  가장 느린 스텝 (샘플 인덱스 / 반복 / 입력):\n");
+    for (int i = 0; i < OUTLIER_COUNT && hist->outliers[i].ns > 0; i++) {
+        const Latency_Outlier_T* o = &hist->outliers[i];
+        printf("    %10llu ns  step %7zu  repeat %2u  current % .6e  voltage %.6f\n",
+               (unsigned long long)o->ns, o->step, (unsigned)o->repeat,
+               trace->current[o->step], trace->voltage[o->step]);
+    }
+}
+
+/* CPU 고정 (Linux) */
+static boolean_T PinCpu(int cpu)
+{
+#ifdef LATENCY_HAVE_AFFINITY
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return (boolean_T)(sched_setaffinity(0, sizeof(set), &set) == 0);
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+static void PrintIsolatedCpus(void)
+{
+    char line[256] = "";
+    FILE* fp = fopen("/sys/devices/system/cpu/isolated", "r");
+    if (fp != NULL) {
+        if (fgets(line, sizeof(line), fp) == NULL) {
+            line[0] = '\0';
+        }
+        fclose(fp);
+    }
+    line[strcspn(line, "\n")] = '\0';
+    printf("# 격리 CPU (isolcpus): %s\n", (line[0] != '\0') ? line : "없음");
+}
+
+static boolean_T WriteHgrm(const char* prefix, const char* name, const Latency_Histogram_T* hist)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s.%s.hgrm", prefix, name);
+    if (!Histogram_WriteHgrm(hist, path)) {
+        fprintf(stderr, "출력 파일을 쓸 수 없음: %s\n", path);
+        return false;
+    }
+    printf("# %s 분포: %s\n", name, path);
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* path = (argc >= 2) ? argv[1] : DEFAULT_TRACE;
+    int cpu = (argc >= 3) ? atoi(argv[2]) : 0;
+    uint32_T repeats = (argc >= 4) ? (uint32_T)atoi(argv[3]) : DEFAULT_REPEATS;
+    const char* prefix = (argc >= 5) ? argv[4] : NULL;
+
+    if (argc > 5 || cpu < 0 || repeats == 0) {
+        fprintf(stderr, "사용법: %s [trace.mat|trace.socbin [cpu [repeats [output_prefix]]]]\n", argv[0]);
+        return 1;
+    }
+
+    TRACE_Reader_T trace;
+    if (!TRACE_Open(path, SOCBIN_HINT_WILLNEED, &trace) || trace.steps == 0) {
+        fprintf(stderr, "기록을 열 수 없음: %s\n", path);
+        return 1;
+    }
+
+    Latency_Histogram_T* modular = (Latency_Histogram_T*)calloc(1, sizeof(Latency_Histogram_T));
+    Latency_Histogram_T* legacy = (Latency_Histogram_T*)calloc(1, sizeof(Latency_Histogram_T));
+    if (modular == NULL || legacy == NULL) {
+        fprintf(stderr, "메모리 부족\n");
+        free(modular);
+        free(legacy);
+        TRACE_Close(&trace);
+        return 1;
+    }
+    modular->min = UINT64_MAX;
+    legacy->min = UINT64_MAX;
+
+    boolean_T pinned = PinCpu(cpu);
+    CalibrateTimer();
+    if (Perf_Requested()) {
+        Perf_Open(&g_perf);
+    }
+
+    /* 초기화 메시지가 결과와 섞이지 않도록 측정 전에 한 번 예열 */
+    MeasureModular(&trace, 1, modular, NULL);
+    memset(modular, 0, sizeof(Latency_Histogram_T));
+    modular->min = UINT64_MAX;
+
+    Perf_Sample_T modular_counters;
+    Perf_Sample_T legacy_counters;
+    Perf_Reset(&modular_counters);
+    Perf_Reset(&legacy_counters);
+    MeasureModular(&trace, repeats, modular, &modular_counters);
+    MeasureLegacy(&trace, repeats, legacy, &legacy_counters);
+
+    printf("\n# %s: %zu 스텝 x %u회, CPU %d %s\n", path, trace.steps, (unsigned)repeats, cpu,
+           pinned ? "고정" : "고정 실패");
+    PrintIsolatedCpus();
+#ifdef LATENCY_HAVE_TSC
+    printf("# 타이머: TSC %.3f GHz, 오버헤드 %llu ticks 차감\n", 1.0 / g_ns_per_tick,
+           (unsigned long long)g_overhead);
+#else
+    printf("# 타이머: clock_gettime, 오버헤드 %llu ns 차감\n", (unsigned long long)g_overhead);
+#endif
+    if (Perf_Requested()) {
+        printf("# 하드웨어 카운터: %s\n", Perf_Describe(&g_perf));
+    }
+    PrintHistogram("modular (SoC_System_Step)", modular, &trace, &modular_counters);
+    PrintHistogram("legacy (SoCesti_step)", legacy, &trace, &legacy_counters);
+
+    int status = 0;
+    if (prefix != NULL && (!WriteHgrm(prefix, "modular", modular) || !WriteHgrm(prefix, "legacy", legacy))) {
+        status = 1;
+    }
+
+    free(modular);
+    free(legacy);
+    Perf_Close(&g_perf);
+    TRACE_Close(&trace);
+    return status;
+}
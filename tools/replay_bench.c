@@ -0,0 +1,247 @@
+/*
+ * replay_bench.c
+ *
+ * 전체 기록 재생 벤치마크 (make bench)
+ * WSN9 기록 전체(37660 스텝, SoCesti의 rtmSetTFinal과 동일)를 여러 번 반복 재생하여
+ * 모듈화된 SoC_System_Step과 기존 생성 코드 SoCesti_step의 처리량을 비교하고,
+ * 두 구현의 SoC 최대 편차와 함께 JSON으로 출력
+ *
+ * 기존 생성 코드는 main.c의 호환 심볼과 이름이 겹치므로 Makefile이 LEGACY_RENAMES로
+ * 접두사(Legacy_)를 붙여 컴파일하며, 이 파일도 같은 정의로 컴파일되어 SoCesti_*
+ * 이름은 기존 생성 코드를 가리킴
+ *
+ * 사용법:
+ *   replay_bench [trace.mat|trace.socbin [repeats [output.json]]]
+ *   (output.json을 생략하면 표준 출력, 시스템 초기화 메시지와 섞일 수 있음)
+ *   SOC_PERF=1이면 측정 반복의 스텝 루프에 하드웨어 카운터를 걸어 스텝당 값을
+ *   "counters"에 기록 (카운터를 열 수 없으면 null)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "core/perf_counters.h"
+#include "io/trace_reader.h"
+
+#include "../rtwtypes.h"
+#include "../SoCesti.h"
+
+/* 상수 정의 */
+#define DEFAULT_TRACE              "WSN9.mat"
+#define DEFAULT_REPEATS            20
+
+/* main.c의 모듈화된 시스템 (BENCH 빌드에서는 main() 없이 링크) */
+extern boolean_T SoC_System_Initialize(void);
+extern void SoC_System_Cleanup(void);
+extern real_T SoC_System_Step(real_T current, real_T voltage);
+
+/* 반복별 측정 통계 */
+typedef struct {
+    double mean;                   /* 스텝당 평균 시간 (ns) */
+    double variance;               /* 반복 간 스텝당 시간 분산 (ns^2) */
+    double min;
+    double max;
+    real_T final_soc;              /* 마지막 스텝 SoC */
+    Perf_Sample_T counters;        /* 측정 반복 전체의 하드웨어 카운터 */
+} Bench_Result_T;
+
+/* 하드웨어 카운터 (SOC_PERF=1일 때만 열림) */
+static Perf_Counters_T g_perf;
+
+static double Now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* 한 번 재생: 모듈화된 시스템 (초기화 / 해제는 시간 / 카운터 측정에서 제외) */
+static real_T ReplayModular(const TRACE_Reader_T* trace, real_T* soc_out, double* elapsed,
+                            Perf_Sample_T* counters)
+{
+    real_T soc = 0.0;
+
+    SoC_System_Initialize();
+    Perf_Start(&g_perf);
+    double t0 = Now();
+    for (size_t k = 0; k < trace->steps; k++) {
+        soc = SoC_System_Step(trace->current[k], trace->voltage[k]);
+        if (soc_out != NULL) {
+            soc_out[k] = soc;
+        }
+    }
+    *elapsed = Now() - t0;
+    Perf_Stop(&g_perf, counters);
+    SoC_System_Cleanup();
+    return soc;
+}
+
+/* 한 번 재생: 기존 생성 코드 */
+static real_T ReplayLegacy(const TRACE_Reader_T* trace, real_T* soc_out, double* elapsed,
+                           Perf_Sample_T* counters)
+{
+    SoCesti_initialize();
+    Perf_Start(&g_perf);
+    double t0 = Now();
+    for (size_t k = 0; k < trace->steps; k++) {
+        SoCesti_U.current = trace->current[k];
+        SoCesti_U.voltage = trace->voltage[k];
+        SoCesti_step();
+        if (soc_out != NULL) {
+            soc_out[k] = SoCesti_Y.SoC;
+        }
+    }
+    *elapsed = Now() - t0;
+    Perf_Stop(&g_perf, counters);
+    SoCesti_terminate();
+    return SoCesti_Y.SoC;
+}
+
+/**
+ * @brief 반복 재생하여 스텝당 시간 통계 계산 (첫 반복에서 SoC 궤적 저장)
+ */
+static void Measure(real_T (*replay)(const TRACE_Reader_T*, real_T*, double*, Perf_Sample_T*),
+                    const TRACE_Reader_T* trace, uint32_T repeats, real_T* soc_out, Bench_Result_T* result)
+{
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    double elapsed;
+
+    result->min = INFINITY;
+    result->max = 0.0;
+    Perf_Reset(&result->counters);
+
+    /* 첫 반복은 궤적 저장 + 캐시 예열용으로 측정에서 제외 */
+    result->final_soc = replay(trace, soc_out, &elapsed, NULL);
+
+    for (uint32_T r = 0; r < repeats; r++) {
+        replay(trace, NULL, &elapsed, &result->counters);
+        double ns = elapsed / (double)trace->steps;
+
+        sum += ns;
+        sum_sq += ns * ns;
+        if (ns < result->min) {
+            result->min = ns;
+        }
+        if (ns > result->max) {
+            result->max = ns;
+        }
+    }
+
+    result->mean = sum / (double)repeats;
+    result->variance = (repeats > 1) ?
+                       (sum_sq - sum * sum / (double)repeats) / (double)(repeats - 1) : 0.0;
+    if (result->variance < 0.0) {
+        result->variance = 0.0;
+    }
+}
+
+static void PrintResult(FILE* out, const char* name, const Bench_Result_T* result, real_T steps,
+                        boolean_T last)
+{
+    fprintf(out, "  \"%s\": {\n", name);
+    fprintf(out, "    \"ns_per_step\": %.3f,\n", result->mean);
+    fprintf(out, "    \"ns_per_step_variance\": %.6f,\n", result->variance);
+    fprintf(out, "    \"ns_per_step_min\": %.3f,\n", result->min);
+    fprintf(out, "    \"ns_per_step_max\": %.3f,\n", result->max);
+    fprintf(out, "    \"steps_per_second\": %.1f,\n", (result->mean > 0.0) ? 1e9 / result->mean : 0.0);
+    fprintf(out, "    \"final_soc\": %.9f,\n", result->final_soc);
+    fprintf(out, "    \"counters\": ");
+    if (g_perf.opened > 0) {
+        Perf_PrintJson(out, &result->counters, steps);
+    } else {
+        fprintf(out, "null");
+    }
+    fprintf(out, "\n");
+    fprintf(out, "  }%s\n", last ? "" : ",");
+}
+
+int main(int argc, char* argv[])
+{
+    const char* path = (argc >= 2) ? argv[1] : DEFAULT_TRACE;
+    uint32_T repeats = (argc >= 3) ? (uint32_T)atoi(argv[2]) : DEFAULT_REPEATS;
+    const char* output = (argc >= 4) ? argv[3] : NULL;
+
+    if (argc > 4 || repeats == 0) {
+        fprintf(stderr, "사용법: %s [trace.mat|trace.socbin [repeats [output.json]]]\n", argv[0]);
+        return 1;
+    }
+
+    TRACE_Reader_T trace;
+    if (!TRACE_Open(path, SOCBIN_HINT_SEQUENTIAL | SOCBIN_HINT_WILLNEED, &trace) || trace.steps == 0) {
+        fprintf(stderr, "기록을 열 수 없음: %s\n", path);
+        return 1;
+    }
+
+    real_T* soc_modular = (real_T*)malloc(trace.steps * sizeof(real_T));
+    real_T* soc_legacy = (real_T*)malloc(trace.steps * sizeof(real_T));
+    if (soc_modular == NULL || soc_legacy == NULL) {
+        fprintf(stderr, "메모리 부족\n");
+        free(soc_modular);
+        free(soc_legacy);
+        TRACE_Close(&trace);
+        return 1;
+    }
+
+    if (Perf_Requested()) {
+        Perf_Open(&g_perf);
+        fprintf(stderr, "# 하드웨어 카운터: %s\n", Perf_Describe(&g_perf));
+    }
+
+    Bench_Result_T modular;
+    Bench_Result_T legacy;
+    Measure(ReplayModular, &trace, repeats, soc_modular, &modular);
+    Measure(ReplayLegacy, &trace, repeats, soc_legacy, &legacy);
+
+    /* 두 구현의 SoC 최대 편차 */
+    real_T max_deviation = 0.0;
+    size_t max_step = 0;
+    for (size_t k = 0; k < trace.steps; k++) {
+        real_T deviation = fabs(soc_modular[k] - soc_legacy[k]);
+        if (deviation > max_deviation) {
+            max_deviation = deviation;
+            max_step = k;
+        }
+    }
+
+    FILE* out = stdout;
+    if (output != NULL) {
+        out = fopen(output, "w");
+        if (out == NULL) {
+            fprintf(stderr, "출력 파일을 열 수 없음: %s\n", output);
+            free(soc_modular);
+            free(soc_legacy);
+            TRACE_Close(&trace);
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"trace\": \"%s\",\n", path);
+    fprintf(out, "  \"steps\": %zu,\n", trace.steps);
+    fprintf(out, "  \"legacy_t_final\": %.1f,\n", rtmGetTFinal(SoCesti_M));
+    fprintf(out, "  \"repeats\": %u,\n", (unsigned)repeats);
+    fprintf(out, "  \"hardware_counters\": \"%s\",\n",
+            Perf_Requested() ? Perf_Describe(&g_perf) : "off (SOC_PERF=1)");
+    real_T counted_steps = (real_T)trace.steps * (real_T)repeats;
+    PrintResult(out, "modular", &modular, counted_steps, false);
+    PrintResult(out, "legacy", &legacy, counted_steps, false);
+    fprintf(out, "  \"speedup\": %.3f,\n", (modular.mean > 0.0) ? legacy.mean / modular.mean : 0.0);
+    fprintf(out, "  \"soc_max_abs_deviation\": %.9f,\n", max_deviation);
+    fprintf(out, "  \"soc_max_deviation_step\": %zu\n", max_step);
+    fprintf(out, "}\n");
+
+    if (out != stdout) {
+        fclose(out);
+    }
+    free(soc_modular);
+    free(soc_legacy);
+    Perf_Close(&g_perf);
+    TRACE_Close(&trace);
+    return 0;
+}
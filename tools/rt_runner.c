@@ -0,0 +1,120 @@
+/*
+ * rt_runner.c
+ *
+ * 실시간 모드 주기 실행기 (make rt)
+ * 초기화(모든 할당)를 끝낸 뒤 RT_Enter로 메모리 고정 / CPU 고정 / SCHED_FIFO /
+ * 비정규 수 0 처리를 적용하고, 기록을 셀 샘플링 시간 주기로 SoC_System_Step에 입력하면서
+ * 마감 위반과 스텝 실행 시간을 집계
+ *
+ * 기록 전체를 실제 시간(샘플링 시간 1 s)으로 재생하면 10시간이 걸리므로 time_scale로
+ * 주기를 줄여 가속 재생 (마감도 같은 비율로 줄어듦)
+ *
+ * 사용법:
+ *   rt_runner [trace.mat|trace.socbin [time_scale [cpu [priority]]]]
+ *   (cpu가 음수이면 CPU를 고정하지 않음, priority 0이면 SCHED_FIFO를 요청하지 않음,
+ *    SCHED_FIFO에는 CAP_SYS_NICE 또는 RLIMIT_RTPRIO 필요. 권한이 없으면 기본 정책으로
+ *    실행하고 결과에 표시)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/rt_mode.h"
+#include "io/trace_reader.h"
+
+#include "../rtwtypes.h"
+
+/* 상수 정의 */
+#define DEFAULT_TRACE              "WSN9.mat"
+#define DEFAULT_TIME_SCALE         1000.0  /* 1 s 샘플링 -> 1 ms 주기 */
+
+/* main.c의 모듈화된 시스템 (BENCH 빌드에서는 main() 없이 링크) */
+extern boolean_T SoC_System_Initialize(void);
+extern void SoC_System_Cleanup(void);
+extern real_T SoC_System_Step(real_T current, real_T voltage);
+extern real_T SoC_System_GetSamplingTime(void);
+
+/* 주기 실행 입력 / 출력 */
+typedef struct {
+    const real_T* current;
+    const real_T* voltage;
+    real_T soc;
+} Runner_Context_T;
+
+static void RunnerStep(void* context, size_t k)
+{
+    Runner_Context_T* runner = (Runner_Context_T*)context;
+    runner->soc = SoC_System_Step(runner->current[k], runner->voltage[k]);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* path = (argc >= 2) ? argv[1] : DEFAULT_TRACE;
+    real_T time_scale = (argc >= 3) ? atof(argv[2]) : DEFAULT_TIME_SCALE;
+    int cpu = (argc >= 4) ? atoi(argv[3]) : 0;
+    int priority = (argc >= 5) ? atoi(argv[4]) : RT_DEFAULT_PRIORITY;
+
+    if (argc > 5 || !(time_scale > 0.0) || priority < 0) {
+        fprintf(stderr, "사용법: %s [trace.mat|trace.socbin [time_scale [cpu [priority]]]]\n", argv[0]);
+        return 1;
+    }
+
+    /* 기록 열기 (mmap, RT_Enter의 mlockall이 함께 고정) */
+    TRACE_Reader_T trace;
+    Runner_Context_T runner;
+    memset(&runner, 0, sizeof(Runner_Context_T));
+    if (!TRACE_Open(path, SOCBIN_HINT_WILLNEED, &trace) || trace.steps == 0) {
+        fprintf(stderr, "기록을 열 수 없음: %s\n", path);
+        TRACE_Close(&trace);
+        return 1;
+    }
+    runner.current = trace.current;
+    runner.voltage = trace.voltage;
+    size_t steps = trace.steps;
+
+    /* 모든 할당은 여기서 끝남 (스텝 경로는 할당하지 않음) */
+    if (!SoC_System_Initialize()) {
+        TRACE_Close(&trace);
+        return 1;
+    }
+    real_T period = SoC_System_GetSamplingTime() / time_scale;
+
+    RT_Config_T config;
+    config.cpu = cpu;
+    config.priority = priority;
+    config.lock_memory = true;
+    config.prefault_stack = RT_DEFAULT_STACK_PREFAULT;
+    config.flush_denormals = true;
+
+    RT_Status_T status;
+    RT_Enter(&config, &status);
+
+    RT_Stats_T stats;
+    boolean_T ran = RT_RunPeriodic(period, steps, RunnerStep, &runner, &stats);
+
+    RT_Leave(&status);
+
+    printf("# %s: %zu 스텝, 주기 %.3f us (샘플링 시간 %.3f s / %.0f)\n", path, steps, period * 1e6,
+           SoC_System_GetSamplingTime(), time_scale);
+    printf("# 메모리 고정 %s, CPU 고정(%d) %s, SCHED_FIFO(%d) %s, 비정규 수 0 처리 %s\n",
+           status.memory_locked ? "성공" : "실패", cpu,
+           (cpu < 0) ? "요청 안 함" : (status.pinned ? "성공" : "실패"),
+           priority, (priority == 0) ? "요청 안 함" : (status.fifo ? "성공" : "실패 (권한 없음)"),
+           status.denormals_flushed ? "성공" : "실패");
+    if (!ran) {
+        fprintf(stderr, "주기 실행을 지원하지 않는 플랫폼\n");
+    } else {
+        printf("스텝 실행 시간: 평균 %.1f ns, 최대 %.1f ns (스텝 %llu)\n", stats.step_mean * 1e9,
+               stats.step_max * 1e9, (unsigned long long)stats.step_max_index);
+        printf("깨어남 지연 최대: %.1f us\n", stats.wakeup_max * 1e6);
+        printf("마감 위반: %llu / %llu 스텝 (건너뛴 주기 %llu)\n",
+               (unsigned long long)stats.deadline_misses, (unsigned long long)stats.steps,
+               (unsigned long long)stats.skipped_periods);
+        printf("최종 SoC: %.6f\n", runner.soc);
+    }
+
+    SoC_System_Cleanup();
+    TRACE_Close(&trace);
+    return ran ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+/*
+ * socbin_convert.c
+ *
+ * 측정 기록 변환 도구 (MAT / CSV -> .socbin)
+ *
+ * 입력:
+ * - .mat: current / voltage 변수 ([시간, 값] 2열, 1열이면 값만 있고 시간은 샘플 인덱스),
+ *         temperature 변수가 있으면 온도 열로 사용
+ * - .csv: time,current,voltage[,temperature[,cell_id]] (숫자로 시작하지 않는 줄은 건너뜀)
+ *
+ * 사용법:
+ *   socbin_convert input.mat|input.csv output.socbin [cell_id]
+ *   (cell_id를 주면 모든 행에 해당 셀 ID 열을 기록)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "io/mat_reader.h"
+#include "io/socbin.h"
+#include "io/trace_reader.h"
+
+#include "../rtwtypes.h"
+
+#define CSV_LINE_SIZE              1024
+#define CSV_MAX_FIELDS             5
+
+/* 변환 중 열 버퍼 (CSV는 행 수를 모르므로 늘려 가며 저장) */
+typedef struct {
+    real_T* timestamp;
+    real_T* current;
+    real_T* voltage;
+    real_T* temperature;
+    uint32_T* cell_id;
+    size_t count;
+    size_t capacity;
+} Trace_T;
+
+static void FreeTrace(Trace_T* trace)
+{
+    free(trace->timestamp);
+    free(trace->current);
+    free(trace->voltage);
+    free(trace->temperature);
+    free(trace->cell_id);
+    memset(trace, 0, sizeof(Trace_T));
+}
+
+static boolean_T ReserveTrace(Trace_T* trace, size_t capacity, boolean_T temperature, boolean_T cell_id)
+{
+    if (capacity <= trace->capacity) {
+        return true;
+    }
+
+    real_T** columns[4] = { &trace->timestamp, &trace->current, &trace->voltage, &trace->temperature };
+    for (int c = 0; c < 4; c++) {
+        if (c == 3 && !temperature) {
+            continue;
+        }
+        real_T* grown = (real_T*)realloc(*columns[c], capacity * sizeof(real_T));
+        if (grown == NULL) {
+            return false;
+        }
+        *columns[c] = grown;
+    }
+    if (cell_id) {
+        uint32_T* grown = (uint32_T*)realloc(trace->cell_id, capacity * sizeof(uint32_T));
+        if (grown == NULL) {
+            return false;
+        }
+        trace->cell_id = grown;
+    }
+    trace->capacity = capacity;
+    return true;
+}
+
+static boolean_T LoadMat(const char* path, Trace_T* trace)
+{
+    MAT_File_T* file = MAT_Open(path);
+    if (file == NULL) {
+        fprintf(stderr, "MAT 파일을 열 수 없음: %s\n", path);
+        return false;
+    }
+
+    MAT_Array_T current;
+    MAT_Array_T voltage;
+    MAT_Array_T temperature;
+    if (!MAT_GetDouble(file, TRACE_CURRENT_NAME, &current) ||
+        !MAT_GetDouble(file, TRACE_VOLTAGE_NAME, &voltage) ||
+        current.cols == 0 || voltage.cols == 0) {
+        fprintf(stderr, "current / voltage 변수가 없음: %s\n", path);
+        MAT_Close(file);
+        return false;
+    }
+    boolean_T has_temperature = MAT_GetDouble(file, "temperature", &temperature) && temperature.cols > 0;
+
+    size_t count = (current.rows < voltage.rows) ? current.rows : voltage.rows;
+    if (has_temperature && temperature.rows < count) {
+        count = temperature.rows;
+    }
+    if (!ReserveTrace(trace, (count > 0) ? count : 1, has_temperature, false)) {
+        fprintf(stderr, "메모리 부족\n");
+        MAT_Close(file);
+        return false;
+    }
+
+    const real_T* current_values = TRACE_ValueColumn(&current);
+    const real_T* voltage_values = TRACE_ValueColumn(&voltage);
+    const real_T* temperature_values = has_temperature ? TRACE_ValueColumn(&temperature) : NULL;
+    for (size_t k = 0; k < count; k++) {
+        trace->timestamp[k] = (current.cols > 1) ? current.data[k] : (real_T)k;
+        trace->current[k] = current_values[k];
+        trace->voltage[k] = voltage_values[k];
+        if (has_temperature) {
+            trace->temperature[k] = temperature_values[k];
+        }
+    }
+    trace->count = count;
+
+    MAT_Close(file);
+    return true;
+}
+
+static boolean_T LoadCsv(const char* path, Trace_T* trace)
+{
+    FILE* fp = fopen(path, "r");
+    if (fp == NULL) {
+        fprintf(stderr, "CSV 파일을 열 수 없음: %s\n", path);
+        return false;
+    }
+
+    char line[CSV_LINE_SIZE];
+    int fields_expected = 0;
+    boolean_T success = true;
+
+    while (success && fgets(line, sizeof(line), fp) != NULL) {
+        char* p = line;
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+        if (!(isdigit((unsigned char)*p) || *p == '-' || *p == '+' || *p == '.')) {
+            continue;  /* 머리글 / 빈 줄 */
+        }
+
+        real_T values[CSV_MAX_FIELDS];
+        int fields = 0;
+        while (fields < CSV_MAX_FIELDS) {
+            char* end;
+            values[fields] = strtod(p, &end);
+            if (end == p) {
+                break;
+            }
+            fields++;
+            p = end;
+            while (isspace((unsigned char)*p) || *p == ',' || *p == ';') {
+                p++;
+            }
+        }
+
+        /* 첫 데이터 행이 열 구성을 결정 */
+        if (fields_expected == 0) {
+            if (fields < 3) {
+                fprintf(stderr, "CSV 열 부족 (time,current,voltage 필요): %s\n", path);
+                success = false;
+                break;
+            }
+            fields_expected = fields;
+        }
+        if (fields < fields_expected) {
+            fprintf(stderr, "CSV %zu번째 데이터 행의 열 부족\n", trace->count + 1);
+            success = false;
+            break;
+        }
+
+        if (trace->count == trace->capacity &&
+            !ReserveTrace(trace, (trace->capacity > 0) ? trace->capacity * 2 : 4096,
+                          (boolean_T)(fields_expected >= 4), (boolean_T)(fields_expected >= 5))) {
+            fprintf(stderr, "메모리 부족\n");
+            success = false;
+            break;
+        }
+
+        size_t k = trace->count++;
+        trace->timestamp[k] = values[0];
+        trace->current[k] = values[1];
+        trace->voltage[k] = values[2];
+        if (fields_expected >= 4) {
+            trace->temperature[k] = values[3];
+        }
+        if (fields_expected >= 5) {
+            trace->cell_id[k] = (uint32_T)values[4];
+        }
+    }
+
+    fclose(fp);
+    return success;
+}
+
+static boolean_T EndsWith(const char* text, const char* suffix)
+{
+    size_t n = strlen(text);
+    size_t m = strlen(suffix);
+    return (boolean_T)(n >= m && strcmp(&text[n - m], suffix) == 0);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3 && argc != 4) {
+        fprintf(stderr, "사용법: %s input.mat|input.csv output.socbin [cell_id]\n", argv[0]);
+        return 1;
+    }
+
+    Trace_T trace;
+    memset(&trace, 0, sizeof(Trace_T));
+
+    boolean_T loaded = EndsWith(argv[1], ".csv") ? LoadCsv(argv[1], &trace) : LoadMat(argv[1], &trace);
+    if (!loaded) {
+        FreeTrace(&trace);
+        return 1;
+    }
+
+    /* 명령행 셀 ID는 CSV의 cell_id 열보다 우선 */
+    if (argc == 4) {
+        uint32_T id = (uint32_T)strtoul(argv[3], NULL, 10);
+        uint32_T* cell_id = (uint32_T*)realloc(trace.cell_id, (trace.count > 0 ? trace.count : 1) * sizeof(uint32_T));
+        if (cell_id == NULL) {
+            fprintf(stderr, "메모리 부족\n");
+            FreeTrace(&trace);
+            return 1;
+        }
+        for (size_t k = 0; k < trace.count; k++) {
+            cell_id[k] = id;
+        }
+        trace.cell_id = cell_id;
+    }
+
+    SOCBIN_Columns_T columns;
+    columns.timestamp = trace.timestamp;
+    columns.current = trace.current;
+    columns.voltage = trace.voltage;
+    columns.temperature = trace.temperature;
+    columns.cell_id = trace.cell_id;
+    columns.count = trace.count;
+
+    if (!SOCBIN_Write(argv[2], &columns)) {
+        fprintf(stderr, ".socbin 쓰기 실패: %s\n", argv[2]);
+        FreeTrace(&trace);
+        return 1;
+    }
+
+    printf("%s -> %s: %zu 행%s%s\n", argv[1], argv[2], trace.count,
+           (trace.temperature != NULL) ? ", 온도" : "", (trace.cell_id != NULL) ? ", 셀 ID" : "");
+    FreeTrace(&trace);
+    return 0;
+}